@@ -0,0 +1,63 @@
+,0xe3,0xe4,0x46,0xf7,0xed,0xe9,0xa1,0x9b
+,0x62,0xa4,0x67,0x7d,0xab,0xf4,0xe3,0xd2
+,0x4b,0x87,0x6b,0xb2,0x84,0x75,0x38,0x96
+,0xe1,0xd6
+,0xe3,0xe4,0x46,0xf7,0xed,0xe9,0xa1,0x9b
+,0x62,0xa4,0x69,0xe7,0x78,0x9b,0xcd,0x95
+,0x4e,0x65,0x8e,0xd3,0x84,0x23,0xe2,0x31
+,0x61,0xdc
+,0xe3,0xe4,0x46,0xf7,0xed,0xe9,0xa1,0x9b
+,0x62,0xa4,0x69,0xe7,0x78,0x9b,0xcd,0x95
+,0x4e,0x65,0x8e,0xd3,0x84,0x23,0xe2,0x31
+,0x61,0xdc
+,0xd3,0x1a,0x8d,0x34,0x64,0x8e,0x60,0xdb
+,0x7b,0x86,0xaf,0xbc,0x53,0xef,0x7e,0xc2
+,0xa4,0xad,0xed,0x51,0x29,0x6e,0x08,0xfe
+,0xa9,0xe2,0xb5,0xa7,0x36,0xee,0x62,0xd6
+,0x3d,0xbe,0xa4,0x5e,0x8c,0xa9,0x67,0x12
+,0x82,0xfa,0xfb,0x69,0xda,0x92,0x72,0x8b
+,0x1a,0x71,0xde,0x0a,0x9e,0x06,0x0b,0x29
+,0x05,0xd6,0xa5,0xb6,0x7e,0xcd,0x3b,0x36
+,0x92,0xdd,0xbd,0x7f,0x2d,0x77,0x8b,0x8c
+,0x98,0x03,0xae,0xe3,0x28,0x09,0x1b,0x58
+,0xfa,0xb3,0x24,0xe4,0xfa,0xd6,0x75,0x94
+,0x55,0x85,0x80,0x8b,0x48,0x31,0xd7,0xbc
+,0x3f,0xf4,0xde,0xf0,0x8e,0x4b,0x7a,0x9d
+,0xe5,0x76,0xd2,0x65,0x86,0xce,0xc6,0x4b
+,0x61,0x16,0x1a,0xe1,0x0b,0x59,0x4f,0x09
+,0xe2,0x6a,0x7e,0x90,0x2e,0xcb,0xd0,0x60
+,0x06,0x91
+,0xd3,0x1a,0x8d,0x34,0x64,0x8e,0x60,0xdb
+,0x7b,0x86,0xaf,0xbc,0x53,0xef,0x7e,0xc2
+,0xa4,0xad,0xed,0x51,0x29,0x6e,0x08,0xfe
+,0xa9,0xe2,0xb5,0xa7,0x36,0xee,0x62,0xd6
+,0x3d,0xbe,0xa4,0x5e,0x8c,0xa9,0x67,0x12
+,0x82,0xfa,0xfb,0x69,0xda,0x92,0x72,0x8b
+,0x1a,0x71,0xde,0x0a,0x9e,0x06,0x0b,0x29
+,0x05,0xd6,0xa5,0xb6,0x7e,0xcd,0x3b,0x36
+,0x92,0xdd,0xbd,0x7f,0x2d,0x77,0x8b,0x8c
+,0x98,0x03,0xae,0xe3,0x28,0x09,0x1b,0x58
+,0xfa,0xb3,0x24,0xe4,0xfa,0xd6,0x75,0x94
+,0x55,0x85,0x80,0x8b,0x48,0x31,0xd7,0xbc
+,0x3f,0xf4,0xde,0xf0,0x8e,0x4b,0x7a,0x9d
+,0xe5,0x76,0xd2,0x65,0x86,0xce,0xc6,0x4b
+,0x61,0x16,0x6a,0x23,0xa4,0x68,0x1f,0xd5
+,0x94,0x56,0xae,0xa1,0xd2,0x9f,0x82,0x47
+,0x72,0x16
+,0xd3,0x1a,0x8d,0x34,0x64,0x8e,0x60,0xdb
+,0x7b,0x86,0xaf,0xbc,0x53,0xef,0x7e,0xc2
+,0xa4,0xad,0xed,0x51,0x29,0x6e,0x08,0xfe
+,0xa9,0xe2,0xb5,0xa7,0x36,0xee,0x62,0xd6
+,0x3d,0xbe,0xa4,0x5e,0x8c,0xa9,0x67,0x12
+,0x82,0xfa,0xfb,0x69,0xda,0x92,0x72,0x8b
+,0x1a,0x71,0xde,0x0a,0x9e,0x06,0x0b,0x29
+,0x05,0xd6,0xa5,0xb6,0x7e,0xcd,0x3b,0x36
+,0x92,0xdd,0xbd,0x7f,0x2d,0x77,0x8b,0x8c
+,0x98,0x03,0xae,0xe3,0x28,0x09,0x1b,0x58
+,0xfa,0xb3,0x24,0xe4,0xfa,0xd6,0x75,0x94
+,0x55,0x85,0x80,0x8b,0x48,0x31,0xd7,0xbc
+,0x3f,0xf4,0xde,0xf0,0x8e,0x4b,0x7a,0x9d
+,0xe5,0x76,0xd2,0x65,0x86,0xce,0xc6,0x4b
+,0x61,0x16,0x6a,0x23,0xa4,0x68,0x1f,0xd5
+,0x94,0x56,0xae,0xa1,0xd2,0x9f,0x82,0x47
+,0x72,0x16
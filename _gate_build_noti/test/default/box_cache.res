@@ -0,0 +1,6 @@
+-1
+hits: 3 misses: 2
+-1
+-1
+lookups: 300
+OK
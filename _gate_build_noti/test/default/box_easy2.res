@@ -0,0 +1,7 @@
+0
+0
+0
+0
+0
+0
+OK
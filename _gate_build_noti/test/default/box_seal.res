@@ -0,0 +1,18 @@
+0
+-1
+-1
+-1
+0
+5
+5
+15
+0
+0
+-1
+-1
+-1
+-1
+0
+-1
+0
+-1
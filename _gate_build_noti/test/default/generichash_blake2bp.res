@@ -0,0 +1,19 @@
+9d9461073e4eb640a255357b839f394b838c6ff57c9b686a3f76107c1066728f3c9956bd785cbc3bf79dc2ab578c5a0c063b9d9c405848de1dbe821cd05c940a
+ff8e90a37b94623932c59f7559f26035029c376732cb14d41602001cbb73adb79293a2dbda5f60703025144d158e2735529596251c73c0345ca6fccb1fb1e97e
+7926708859e6e2ab68f604da69a9fb5087bb33f4e8d895730e301ab2d7df748b67df0b6b8622e52dd57d8d3ad87d5820d4ecfd24178b2d2b78d64f4fbd387582
+9280f4d1157032ab315c100d636283fbf4fba2fbad0f8bc020721d76bc1c8973ced28871cc907dab60e59756987b0e0f867fa2fe9d9041f2c9618074e44fe5e9
+5530c2d59f144872e987e4e258a7d8c38ce844e2cc2eed940ffc683b498815e53adb1faaf568946122805ac3b8e2fed435fed6162e76f564e586ba464424e885
+96fbcbb60bd313b8845033e5bc058a38027438572d7e7957f3684f6268aadd3ad08d21767ed6878685331ba98571487e12470aad669326716e46667f69f8d7e8
+9915a97dc3df81251f1778dfc4fa02a2ad8cfc8f89b51ac19e90a45f372069015d8b4e877b330d7e53d1ef636fa7b6f8736b2e049aa98d2f7c85c9615df9e2ec
+eb7b7bb4d5217025705e949d98db93ee62e64f6fb9e6f45108a5f7ebe2908161294b0e8c904afa9d57c506e9da3b02806fd5767ae55498eb3bb8cd7f091b572d
+14ba32c1c80bb32c8282aa53f341f45daabda12bda41f7ad8ec75baa743a41adf2376ad3de32fb576d3efdcadf3f59d25b40b915681cc90dee3a9b2cb02061ea
+2d9af8503c1b107aece8ecc73f2c2a6ecfe3def943ab277bb3323643b8bbd33631e34d0f095a4afb0193b2d44bcd11383d60ad020472b19f28f3edf3dbcbdcda
+f8902562400af0a16874e0ab432d5442dfa82439a220f927c8c654076cdb1fd84b6f60a170da9e81e4eb03a0e82a66edc39a3fcaff3b8cbb538e877389502465
+868a4be429bfe126796f528004b99bb79b3cb149771e8d9f0d962e39d58db1c28d42dcf23eaed7361fe1ae8bc182a7e036352bf571976d2bfd63e92d920bb49a
+6299dbe0f10ddacd95d879924976dbcf8863aac5f3fcb873ac7ab2397cb809cb66d666c33167a2c61f24a6a9da1778269e44dde152d175a96d3fb7bbaf79b8bc
+3dec51ff2957f5e7293fa63606014da873c31982813cde562755fa17d547d386f1229c19895626478965fd0da4dda04839f28a7eaf06db77813cbc6721d37296
+be3d2257d19f6cc37c187776a8df59f10c0e0921061ca410251acd4685858bf0459962765ac2e98f370058ed0e2dadda64fa5bea082f8a9a5aab99b132dfe09e
+9489e7b7d8f63097f1a00b06d1f2b02d296c510b5cac468d1ee57370619be850
+0cf6581962337d7e28d20f2e9ecec7a98d3aefb0f4dbd6536c5d5544c0dc4640be6d078d415a6529e4a3493e42a593e3d8d5fac14e945f7b68eef0f4d3f5779f
+0 0 0 0 0 
+-1 0 -1 -1 -1 -1
@@ -0,0 +1,40 @@
+a1
+f42d87164fd88641
+d5fa0669676f20aa305ff8c060db3d
+20795d565ce4917e3126e6b275bbc3535be23319a73e
+9531e6fa58ef7f52893538eed783bae98a7b0ed0e0e6fb6efbab8c2005
+d047ead7
+46743064328495aeef1522
+f5eb6748d1d6944316dbcc2aae283f8f3c2b
+982a75babcface6fe280284449c2972f320e3c1e1bb8ec203b
+cf0ef1c2870a0171d13dbff752cdb307bdb28e4fbb1f20b2fdf0d029971ed081
+a0713a95e68834
+5ddb3316606ee0fc6a4ba798de69
+608a0010f8e9d7c3abed2eee09a3f8c0207f929e30
+7a96ca4574f57fa72aa5842f5985c04a69d1bc01ad348383595fcdac
+e6fc45
+7ab321e8f0d55b68c4e1
+7dd21491e5c1ce3645e5e6a07b8b6ddb2d
+bfb1920208e475572aca6d888fed3d28d0e8805c2ef4ce05
+35faf52355e9d73d467946cb91cebd74e73155f68e94d71b20018ca2542d9d
+753c46b0080a
+344855f35b4cb20f76b37aaa03
+c5f2c59a7823e23b52d303246d7bbe21cb5d3815
+7fa42ea7dce365529470574b1fdb831b9d336a8bab40fed7f1b377
+ba8b
+8e5baadb10c387def3
+31ef8ee831ede466c51001628e11e4d0
+2c6da472c569ecb43d3d98ae9c456c4674744f14ddf233
+fb50a6ea010dc889f03c44b8cb595055b59c56ee44ad8b98d048c8ccef7f
+69e2bffe70
+2e5141acfde4b49845c5bd8e
+c0a76ff58a9e98407df4de4c69554e2d3c6045
+63ac1c1c7cabcceb27f4829d0cc16081ae5ed6cb996c9cc0a14d
+8b
+2051f786588f072a
+9ddb4de7f3686f14f457caf1514e10
+1806e0cd6204ac1c26bd5d29fed841849532484b7018
+ccb7d4a5bdf8d303ec4de27290ba7eb1333a919ba5345a3568899c2a11
+6733b4c37e09e81f286bf10a7ee0d87e0690cf7467a26155658362525935199a
+efb5fd1b3b65fbc60e196f8e53125e11148a5b564037c4808eae3a4b894a56fa
+-1 -1 -1 -1
@@ -0,0 +1,8 @@
+0
+0418730dfc36783131c15ec180c864e60dc64a0967dc45bf3737fcb5ea33de7a3f3a3a8f9aa1f92b13841038449bed99956cc0eb57c137f3440fbb7ed064ed4f
+0
+0 0 0 0 
+0
+0
+0
+0
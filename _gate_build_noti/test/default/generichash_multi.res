@@ -0,0 +1,5 @@
+mismatches: 0
+4e51e7a913fc80137da52880fecca175bf81e117d5c68126dc2774033517ea0d
+c565484d6e4d8652d2f9b01c02e98941725268bf60879b6c66152eab40545786
+4baee75b2380d63055bd97cc2950b7ad10eed536fa35a6c582810aa0251109b7
+6db4da3babeb9252e6135116f90f626256d51e1c470bf0a9385f96ecfe3ea7d9
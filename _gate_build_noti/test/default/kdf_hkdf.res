@@ -0,0 +1,11 @@
+prk: 077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5
+okm: 3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865
+0 0 0 0 
+prk (no salt): 19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04
+-1 -1
+prk: 665799823737ded04a88e47e54a5890bb2c3d247c7a4254a8e61350723590a26c36238127d8661b88cf80ef802d57e2f7cebcf1e00e083848be19929c61b4237
+okm: 832390086cda71fb47625bb5ceb168e4c8e26a1a16ed34d9fc7fe92c1481579338da362cb8d9f925d7cb
+0 0 0 0 
+prk (no salt): fd200c4987ac491313bd4a2a13287121247239e11c9ef82802044b66ef357e5b194498d0682611382348572a7b1611de54764094286320578a863f36562b0df6
+-1 -1
+tv_kdf_hkdf: ok
@@ -0,0 +1 @@
+OK
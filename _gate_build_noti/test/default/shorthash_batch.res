@@ -0,0 +1,6 @@
+mismatches: 0
+3cb6f5c74d151020
+a822a5a14f391496
+8793a7900084148a
+341908a34d9c8059
+88394015321612ef
@@ -0,0 +1,8 @@
+fresh: ok
+replays: 1000
+forgotten: ok
+0
+-1
+0
+0
+0
@@ -0,0 +1,24 @@
+0
+0
+-1
+0
+0
+30313233343536373839414243444546
+4:cafe6942
+dt1: 11
+4:69426942
+dt2: 2
+dt3: 11
+dt4: 11
+dt5: 11
+010000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+010100000000000000000000000000000000000000000000
+020000000000000000000000000000000000000000000000
+0001ff000000000000000000000000000000000000000000
+000000000000fffefefefefefefefefefefefefefefefefe
+00000000000000000000fffefefefefefefefefefefefefe
+00000000000000000000000000000000000000000000fffe
+fcfffffffffffbfdfefefefefefefefefefefefefefefefe
+fcfffffffffffffffffffbfdfefefefefefefefefefefefe
+fcfffffffffffffffffffffffffffffffffffffffffffbfd
@@ -0,0 +1,3 @@
+OK
+Intentional segfault / bus error caught
+OK
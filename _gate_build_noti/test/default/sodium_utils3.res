@@ -0,0 +1,2 @@
+Intentional segfault / bus error caught
+OK
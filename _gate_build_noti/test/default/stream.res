@@ -0,0 +1,2 @@
+662b9d0e3463029156069b12f918691a98f7dfb2ca0393c96bbfc6b1fbd630a2
+0cc9ffaf60a99d221b548e9762385a231121ab226d1c610d2661ced26b6ad5ee
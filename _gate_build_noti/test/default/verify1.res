@@ -0,0 +1,2 @@
+OK
+OK
@@ -108,3 +108,77 @@ crypto_auth_hmacsha256(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+#define HMAC_MULTI_CHUNK 64U
+
+int
+crypto_auth_hmacsha256_multi(unsigned char *out,
+                             const unsigned char * const *in,
+                             const unsigned long long *inlen, size_t n,
+                             const unsigned char *k)
+{
+    crypto_auth_hmacsha256_state state;
+    const unsigned char         *ihash[HMAC_MULTI_CHUNK];
+    unsigned long long           ihashlen[HMAC_MULTI_CHUNK];
+    size_t                       chunk;
+    size_t                       i;
+    size_t                       j;
+
+    crypto_auth_hmacsha256_init(&state, k, crypto_auth_hmacsha256_KEYBYTES);
+    _crypto_hash_sha256_multi_from_state(out, in, inlen, n, &state.ictx);
+
+    /* the inner hashes are replaced in place with the outer ones */
+    for (i = 0U; i < n; i += chunk) {
+        chunk = n - i < HMAC_MULTI_CHUNK ? n - i : HMAC_MULTI_CHUNK;
+        for (j = 0U; j < chunk; j++) {
+            ihash[j] = &out[(i + j) * crypto_auth_hmacsha256_BYTES];
+            ihashlen[j] = crypto_auth_hmacsha256_BYTES;
+        }
+        _crypto_hash_sha256_multi_from_state
+            (&out[i * crypto_auth_hmacsha256_BYTES], ihash, ihashlen, chunk,
+             &state.octx);
+    }
+    sodium_memzero((void *) &state, sizeof state);
+
+    return 0;
+}
+
+int
+crypto_auth_hmacsha256_keyed_init(crypto_auth_hmacsha256_keyed_state *kstate,
+                                  const unsigned char *key, size_t keylen)
+{
+    crypto_auth_hmacsha256_state state;
+
+    crypto_auth_hmacsha256_init(&state, key, keylen);
+    memcpy(kstate->istate, state.ictx.state, sizeof kstate->istate);
+    memcpy(kstate->ostate, state.octx.state, sizeof kstate->ostate);
+    sodium_memzero((void *) &state, sizeof state);
+
+    return 0;
+}
+
+int
+crypto_auth_hmacsha256_keyed_start(crypto_auth_hmacsha256_state *state,
+                                   const crypto_auth_hmacsha256_keyed_state *kstate)
+{
+    memcpy(state->ictx.state, kstate->istate, sizeof kstate->istate);
+    state->ictx.count = (uint64_t) 512U;
+    memcpy(state->octx.state, kstate->ostate, sizeof kstate->ostate);
+    state->octx.count = (uint64_t) 512U;
+
+    return 0;
+}
+
+int
+crypto_auth_hmacsha256_keyed(unsigned char *out, const unsigned char *in,
+                             unsigned long long inlen,
+                             const crypto_auth_hmacsha256_keyed_state *kstate)
+{
+    crypto_auth_hmacsha256_state state;
+
+    crypto_auth_hmacsha256_keyed_start(&state, kstate);
+    crypto_auth_hmacsha256_update(&state, in, inlen);
+    crypto_auth_hmacsha256_final(&state, out);
+
+    return 0;
+}
@@ -14,3 +14,8 @@ size_t
 crypto_auth_hmacsha512_statebytes(void) {
     return sizeof(crypto_auth_hmacsha512_state);
 }
+
+size_t
+crypto_auth_hmacsha512_keyed_statebytes(void) {
+    return sizeof(crypto_auth_hmacsha512_keyed_state);
+}
@@ -10,3 +10,14 @@ int crypto_auth_hmacsha512_verify(const unsigned char *h, const unsigned char *i
   return crypto_verify_64(h,correct) | (-(h == correct)) |
          sodium_memcmp(correct,h,64);
 }
+
+int crypto_auth_hmacsha512_keyed_verify(const unsigned char *h,
+                                        const unsigned char *in,
+                                        unsigned long long inlen,
+                                        const crypto_auth_hmacsha512_keyed_state *kstate)
+{
+  unsigned char correct[64];
+  crypto_auth_hmacsha512_keyed(correct,in,inlen,kstate);
+  return crypto_verify_64(h,correct) | (-(h == correct)) |
+         sodium_memcmp(correct,h,64);
+}
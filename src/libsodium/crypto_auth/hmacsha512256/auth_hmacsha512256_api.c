@@ -14,3 +14,8 @@ size_t
 crypto_auth_hmacsha512256_statebytes(void) {
     return sizeof(crypto_auth_hmacsha512256_state);
 }
+
+size_t
+crypto_auth_hmacsha512256_keyed_statebytes(void) {
+    return sizeof(crypto_auth_hmacsha512256_keyed_state);
+}
@@ -52,3 +52,61 @@ crypto_auth_hmacsha512256(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+int
+crypto_auth_hmacsha512256_keyed_init(crypto_auth_hmacsha512256_keyed_state *kstate,
+                                     const unsigned char *key, size_t keylen)
+{
+    return crypto_auth_hmacsha512_keyed_init
+        ((crypto_auth_hmacsha512_keyed_state *) kstate, key, keylen);
+}
+
+int
+crypto_auth_hmacsha512256_keyed_start(crypto_auth_hmacsha512256_state *state,
+                                      const crypto_auth_hmacsha512256_keyed_state *kstate)
+{
+    return crypto_auth_hmacsha512_keyed_start
+        ((crypto_auth_hmacsha512_state *) state,
+         (const crypto_auth_hmacsha512_keyed_state *) kstate);
+}
+
+int
+crypto_auth_hmacsha512256_keyed(unsigned char *out, const unsigned char *in,
+                                unsigned long long inlen,
+                                const crypto_auth_hmacsha512256_keyed_state *kstate)
+{
+    crypto_auth_hmacsha512256_state state;
+
+    crypto_auth_hmacsha512256_keyed_start(&state, kstate);
+    crypto_auth_hmacsha512256_update(&state, in, inlen);
+    crypto_auth_hmacsha512256_final(&state, out);
+
+    return 0;
+}
+
+#define HMAC_MULTI_CHUNK 64U
+
+int
+crypto_auth_hmacsha512256_multi(unsigned char *out,
+                                const unsigned char * const *in,
+                                const unsigned long long *inlen, size_t n,
+                                const unsigned char *k)
+{
+    unsigned char out0[HMAC_MULTI_CHUNK * crypto_auth_hmacsha512_BYTES];
+    size_t        chunk;
+    size_t        i;
+    size_t        j;
+
+    for (i = 0U; i < n; i += chunk) {
+        chunk = n - i < HMAC_MULTI_CHUNK ? n - i : HMAC_MULTI_CHUNK;
+        crypto_auth_hmacsha512_multi(out0, &in[i], &inlen[i], chunk, k);
+        for (j = 0U; j < chunk; j++) {
+            memcpy(&out[(i + j) * crypto_auth_hmacsha512256_BYTES],
+                   &out0[j * crypto_auth_hmacsha512_BYTES],
+                   crypto_auth_hmacsha512256_BYTES);
+        }
+    }
+    sodium_memzero(out0, sizeof out0);
+
+    return 0;
+}
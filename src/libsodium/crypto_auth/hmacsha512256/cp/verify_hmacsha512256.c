@@ -12,3 +12,14 @@ int crypto_auth_hmacsha512256_verify(const unsigned char *h,
   return crypto_verify_32(h,correct) | (-(h == correct)) |
          sodium_memcmp(correct,h,32);
 }
+
+int crypto_auth_hmacsha512256_keyed_verify(const unsigned char *h,
+                                           const unsigned char *in,
+                                           unsigned long long inlen,
+                                           const crypto_auth_hmacsha512256_keyed_state *kstate)
+{
+  unsigned char correct[32];
+  crypto_auth_hmacsha512256_keyed(correct,in,inlen,kstate);
+  return crypto_verify_32(h,correct) | (-(h == correct)) |
+         sodium_memcmp(correct,h,32);
+}
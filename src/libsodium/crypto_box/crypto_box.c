@@ -68,6 +68,20 @@ crypto_box_keypair(unsigned char *pk, unsigned char *sk)
     return crypto_box_curve25519xsalsa20poly1305_keypair(pk, sk);
 }
 
+int
+crypto_box_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                              const unsigned char *seeds, size_t n)
+{
+    return crypto_box_curve25519xsalsa20poly1305_seed_keypair_batch(pks, sks,
+                                                                    seeds, n);
+}
+
+int
+crypto_box_keypair_batch(unsigned char *pks, unsigned char *sks, size_t n)
+{
+    return crypto_box_curve25519xsalsa20poly1305_keypair_batch(pks, sks, n);
+}
+
 int
 crypto_box_beforenm(unsigned char *k, const unsigned char *pk,
                     const unsigned char *sk)
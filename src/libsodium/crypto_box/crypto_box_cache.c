@@ -0,0 +1,329 @@
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto_box.h"
+#include "crypto_generichash_blake2b.h"
+#include "randombytes.h"
+#include "utils.h"
+#include "private/common.h"
+#include "private/mutex.h"
+
+#define CACHE_SHARDS     16U
+#define CACHE_TAGBYTES   32U
+#define CACHE_NONE       UINT32_MAX
+
+/*
+ * Entries are identified by a keyed hash of (sk, pk), so that secret keys
+ * are never stored in the cache. The first byte of the tag selects a shard,
+ * and the following bytes the bucket in that shard's hash table.
+ */
+
+typedef struct CacheEntry_ {
+    unsigned char tag[CACHE_TAGBYTES];
+    unsigned char k[crypto_box_BEFORENMBYTES];
+    uint32_t      chain_next;
+    uint32_t      lru_prev;
+    uint32_t      lru_next;
+} CacheEntry;
+
+typedef struct CacheShard_ {
+    sodium_mutex_t     lock;
+    CacheEntry        *entries;
+    uint32_t          *buckets;
+    uint32_t           buckets_mask;
+    uint32_t           capacity;
+    uint32_t           count;
+    uint32_t           lru_head;
+    uint32_t           lru_tail;
+    unsigned long long hits;
+    unsigned long long misses;
+} CacheShard;
+
+struct crypto_box_cache {
+    /* a prepared crypto_generichash_blake2b_state, copied for every tag */
+    unsigned char tag_state[sizeof(crypto_generichash_blake2b_state)];
+    CacheShard    shards[CACHE_SHARDS];
+};
+
+static void
+_cache_tag(unsigned char tag[CACHE_TAGBYTES], const crypto_box_cache *cache,
+           const unsigned char *pk, const unsigned char *sk)
+{
+    crypto_generichash_blake2b_state st;
+
+    memcpy(&st, cache->tag_state, sizeof st);
+    crypto_generichash_blake2b_update(&st, sk, crypto_box_SECRETKEYBYTES);
+    crypto_generichash_blake2b_update(&st, pk, crypto_box_PUBLICKEYBYTES);
+    crypto_generichash_blake2b_final(&st, tag, CACHE_TAGBYTES);
+    sodium_memzero(&st, sizeof st);
+}
+
+static uint32_t *
+_cache_bucket(CacheShard *shard, const unsigned char tag[CACHE_TAGBYTES])
+{
+    return &shard->buckets[LOAD32_LE(&tag[1]) & shard->buckets_mask];
+}
+
+static void
+_cache_lru_unlink(CacheShard *shard, uint32_t i)
+{
+    CacheEntry *entry = &shard->entries[i];
+
+    if (entry->lru_prev != CACHE_NONE) {
+        shard->entries[entry->lru_prev].lru_next = entry->lru_next;
+    } else {
+        shard->lru_head = entry->lru_next;
+    }
+    if (entry->lru_next != CACHE_NONE) {
+        shard->entries[entry->lru_next].lru_prev = entry->lru_prev;
+    } else {
+        shard->lru_tail = entry->lru_prev;
+    }
+}
+
+static void
+_cache_lru_push(CacheShard *shard, uint32_t i)
+{
+    CacheEntry *entry = &shard->entries[i];
+
+    entry->lru_prev = CACHE_NONE;
+    entry->lru_next = shard->lru_head;
+    if (shard->lru_head != CACHE_NONE) {
+        shard->entries[shard->lru_head].lru_prev = i;
+    } else {
+        shard->lru_tail = i;
+    }
+    shard->lru_head = i;
+}
+
+static int
+_cache_lookup(CacheShard *shard, unsigned char *k,
+              const unsigned char tag[CACHE_TAGBYTES])
+{
+    uint32_t i = *_cache_bucket(shard, tag);
+
+    while (i != CACHE_NONE) {
+        if (sodium_memcmp(shard->entries[i].tag, tag, CACHE_TAGBYTES) == 0) {
+            memcpy(k, shard->entries[i].k, crypto_box_BEFORENMBYTES);
+            if (shard->lru_head != i) {
+                _cache_lru_unlink(shard, i);
+                _cache_lru_push(shard, i);
+            }
+            return 0;
+        }
+        i = shard->entries[i].chain_next;
+    }
+    return -1;
+}
+
+static void
+_cache_evict(CacheShard *shard, uint32_t i)
+{
+    uint32_t *link = _cache_bucket(shard, shard->entries[i].tag);
+
+    while (*link != i) {
+        link = &shard->entries[*link].chain_next;
+    }
+    *link = shard->entries[i].chain_next;
+    _cache_lru_unlink(shard, i);
+    sodium_memzero(&shard->entries[i], sizeof shard->entries[i]);
+}
+
+static void
+_cache_insert(CacheShard *shard, const unsigned char *k,
+              const unsigned char tag[CACHE_TAGBYTES])
+{
+    uint32_t *bucket;
+    uint32_t  i;
+
+    if (shard->count < shard->capacity) {
+        i = shard->count++;
+    } else {
+        i = shard->lru_tail;
+        _cache_evict(shard, i);
+    }
+    memcpy(shard->entries[i].tag, tag, CACHE_TAGBYTES);
+    memcpy(shard->entries[i].k, k, crypto_box_BEFORENMBYTES);
+    bucket = _cache_bucket(shard, tag);
+    shard->entries[i].chain_next = *bucket;
+    *bucket = i;
+    _cache_lru_push(shard, i);
+}
+
+crypto_box_cache *
+crypto_box_cache_new(size_t capacity)
+{
+    crypto_generichash_blake2b_state st;
+    unsigned char                    tag_key[crypto_generichash_blake2b_KEYBYTES];
+    crypto_box_cache                *cache;
+    CacheShard                      *shard;
+    uint32_t                         shard_capacity;
+    uint32_t                         nbuckets;
+    size_t                           i;
+    size_t                           j;
+
+    if (capacity == 0U || capacity > (size_t) UINT32_MAX - CACHE_SHARDS) {
+        return NULL;
+    }
+    shard_capacity = (uint32_t) ((capacity + CACHE_SHARDS - 1U) / CACHE_SHARDS);
+    nbuckets = 1U;
+    while (nbuckets < shard_capacity && nbuckets < (1U << 31)) {
+        nbuckets <<= 1;
+    }
+    if ((cache = (crypto_box_cache *) sodium_malloc(sizeof *cache)) == NULL) {
+        return NULL;
+    }
+    randombytes_buf(tag_key, sizeof tag_key);
+    crypto_generichash_blake2b_keyed_prepare(&st, tag_key, sizeof tag_key,
+                                             CACHE_TAGBYTES);
+    memcpy(cache->tag_state, &st, sizeof cache->tag_state);
+    sodium_memzero(&st, sizeof st);
+    sodium_memzero(tag_key, sizeof tag_key);
+    for (i = 0U; i < CACHE_SHARDS; i++) {
+        shard = &cache->shards[i];
+        shard->entries = (CacheEntry *)
+            sodium_allocarray(shard_capacity, sizeof shard->entries[0]);
+        shard->buckets = (uint32_t *)
+            sodium_allocarray(nbuckets, sizeof shard->buckets[0]);
+        if (shard->entries == NULL || shard->buckets == NULL ||
+            sodium_mutex_init(&shard->lock) != 0) {
+            sodium_free(shard->entries);
+            sodium_free(shard->buckets);
+            while (i-- > 0U) {
+                sodium_mutex_destroy(&cache->shards[i].lock);
+                sodium_free(cache->shards[i].entries);
+                sodium_free(cache->shards[i].buckets);
+            }
+            sodium_free(cache);
+            return NULL;
+        }
+        for (j = 0U; j < nbuckets; j++) {
+            shard->buckets[j] = CACHE_NONE;
+        }
+        shard->buckets_mask = nbuckets - 1U;
+        shard->capacity = shard_capacity;
+        shard->count = 0U;
+        shard->lru_head = shard->lru_tail = CACHE_NONE;
+        shard->hits = shard->misses = 0U;
+    }
+    return cache;
+}
+
+void
+crypto_box_cache_free(crypto_box_cache *cache)
+{
+    size_t i;
+
+    if (cache == NULL) {
+        return;
+    }
+    for (i = 0U; i < CACHE_SHARDS; i++) {
+        sodium_mutex_destroy(&cache->shards[i].lock);
+        sodium_free(cache->shards[i].entries);
+        sodium_free(cache->shards[i].buckets);
+    }
+    sodium_free(cache);
+}
+
+int
+crypto_box_cache_beforenm(crypto_box_cache *cache, unsigned char *k,
+                          const unsigned char *pk, const unsigned char *sk)
+{
+    unsigned char tag[CACHE_TAGBYTES];
+    CacheShard   *shard;
+    int           found;
+
+    _cache_tag(tag, cache, pk, sk);
+    shard = &cache->shards[tag[0] % CACHE_SHARDS];
+
+    if (sodium_mutex_lock(&shard->lock) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    found = _cache_lookup(shard, k, tag) == 0;
+    if (found) {
+        shard->hits++;
+    } else {
+        shard->misses++;
+    }
+    sodium_mutex_unlock(&shard->lock);
+    if (found) {
+        return 0;
+    }
+
+    /* computed without holding the lock */
+    if (crypto_box_beforenm(k, pk, sk) != 0) {
+        return -1;
+    }
+    if (sodium_mutex_lock(&shard->lock) != 0) {
+        return 0; /* LCOV_EXCL_LINE */
+    }
+    if (_cache_lookup(shard, k, tag) != 0) {
+        _cache_insert(shard, k, tag);
+    }
+    sodium_mutex_unlock(&shard->lock);
+
+    return 0;
+}
+
+int
+crypto_box_easy_cached(crypto_box_cache *cache,
+                       unsigned char *c, const unsigned char *m,
+                       unsigned long long mlen, const unsigned char *n,
+                       const unsigned char *pk, const unsigned char *sk)
+{
+    unsigned char k[crypto_box_BEFORENMBYTES];
+    int           ret;
+
+    if (crypto_box_cache_beforenm(cache, k, pk, sk) != 0) {
+        return -1;
+    }
+    ret = crypto_box_easy_afternm(c, m, mlen, n, k);
+    sodium_memzero(k, sizeof k);
+
+    return ret;
+}
+
+int
+crypto_box_open_easy_cached(crypto_box_cache *cache,
+                            unsigned char *m, const unsigned char *c,
+                            unsigned long long clen, const unsigned char *n,
+                            const unsigned char *pk, const unsigned char *sk)
+{
+    unsigned char k[crypto_box_BEFORENMBYTES];
+    int           ret;
+
+    if (crypto_box_cache_beforenm(cache, k, pk, sk) != 0) {
+        return -1;
+    }
+    ret = crypto_box_open_easy_afternm(m, c, clen, n, k);
+    sodium_memzero(k, sizeof k);
+
+    return ret;
+}
+
+void
+crypto_box_cache_stats(crypto_box_cache *cache,
+                       unsigned long long *hits, unsigned long long *misses)
+{
+    CacheShard        *shard;
+    unsigned long long total_hits = 0U;
+    unsigned long long total_misses = 0U;
+    size_t             i;
+
+    for (i = 0U; i < CACHE_SHARDS; i++) {
+        shard = &cache->shards[i];
+        if (sodium_mutex_lock(&shard->lock) != 0) {
+            continue; /* LCOV_EXCL_LINE */
+        }
+        total_hits += shard->hits;
+        total_misses += shard->misses;
+        sodium_mutex_unlock(&shard->lock);
+    }
+    if (hits != NULL) {
+        *hits = total_hits;
+    }
+    if (misses != NULL) {
+        *misses = total_misses;
+    }
+}
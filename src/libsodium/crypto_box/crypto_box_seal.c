@@ -1,9 +1,29 @@
 
+#include <stdint.h>
 #include <string.h>
 
 #include "crypto_box.h"
 #include "crypto_generichash.h"
+#include "randombytes.h"
 #include "utils.h"
+#include "private/common.h"
+#include "private/mutex.h"
+
+#define SEAL_POOL_REFILL_CHUNK 16U
+#define SEAL_MULTI_HINTBYTES   8U
+
+typedef struct SealPoolEntry_ {
+    unsigned char pk[crypto_box_PUBLICKEYBYTES];
+    unsigned char sk[crypto_box_SECRETKEYBYTES];
+} SealPoolEntry;
+
+struct crypto_box_seal_pool {
+    sodium_mutex_t lock;
+    SealPoolEntry *entries;
+    size_t         capacity;
+    size_t         head;
+    size_t         count;
+};
 
 static int
 _crypto_box_seal_nonce(unsigned char *nonce,
@@ -19,29 +39,179 @@ _crypto_box_seal_nonce(unsigned char *nonce,
     return 0;
 }
 
-int
-crypto_box_seal(unsigned char *c, const unsigned char *m,
-                unsigned long long mlen, const unsigned char *pk)
+static int
+_crypto_box_seal(unsigned char *c, const unsigned char *m,
+                 unsigned long long mlen, const unsigned char *pk,
+                 unsigned char *epk, unsigned char *esk)
 {
     unsigned char nonce[crypto_box_NONCEBYTES];
-    unsigned char epk[crypto_box_PUBLICKEYBYTES];
-    unsigned char esk[crypto_box_SECRETKEYBYTES];
     int           ret;
 
-    if (crypto_box_keypair(epk, esk) != 0) {
-        return -1; /* LCOV_EXCL_LINE */
-    }
     memcpy(c, epk, crypto_box_PUBLICKEYBYTES);
     _crypto_box_seal_nonce(nonce, epk, pk);
     ret = crypto_box_easy(c + crypto_box_PUBLICKEYBYTES, m, mlen,
                           nonce, pk, esk);
-    sodium_memzero(esk, sizeof esk);
-    sodium_memzero(epk, sizeof epk);
+    sodium_memzero(esk, crypto_box_SECRETKEYBYTES);
+    sodium_memzero(epk, crypto_box_PUBLICKEYBYTES);
     sodium_memzero(nonce, sizeof nonce);
 
     return ret;
 }
 
+int
+crypto_box_seal(unsigned char *c, const unsigned char *m,
+                unsigned long long mlen, const unsigned char *pk)
+{
+    unsigned char epk[crypto_box_PUBLICKEYBYTES];
+    unsigned char esk[crypto_box_SECRETKEYBYTES];
+
+    if (crypto_box_keypair(epk, esk) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    return _crypto_box_seal(c, m, mlen, pk, epk, esk);
+}
+
+crypto_box_seal_pool *
+crypto_box_seal_pool_new(size_t capacity)
+{
+    crypto_box_seal_pool *pool;
+
+    if (capacity == 0U) {
+        return NULL;
+    }
+    if ((pool = (crypto_box_seal_pool *) sodium_malloc(sizeof *pool)) == NULL) {
+        return NULL;
+    }
+    pool->entries = (SealPoolEntry *)
+        sodium_allocarray(capacity, sizeof pool->entries[0]);
+    if (pool->entries == NULL || sodium_mutex_init(&pool->lock) != 0) {
+        sodium_free(pool->entries);
+        sodium_free(pool);
+        return NULL;
+    }
+    pool->capacity = capacity;
+    pool->head = 0U;
+    pool->count = 0U;
+
+    return pool;
+}
+
+void
+crypto_box_seal_pool_free(crypto_box_seal_pool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    sodium_mutex_destroy(&pool->lock);
+    sodium_free(pool->entries);
+    sodium_free(pool);
+}
+
+size_t
+crypto_box_seal_pool_available(crypto_box_seal_pool *pool)
+{
+    size_t count;
+
+    if (sodium_mutex_lock(&pool->lock) != 0) {
+        return 0U; /* LCOV_EXCL_LINE */
+    }
+    count = pool->count;
+    sodium_mutex_unlock(&pool->lock);
+
+    return count;
+}
+
+size_t
+crypto_box_seal_pool_refill(crypto_box_seal_pool *pool, size_t max_keys)
+{
+    unsigned char pks[SEAL_POOL_REFILL_CHUNK * crypto_box_PUBLICKEYBYTES];
+    unsigned char sks[SEAL_POOL_REFILL_CHUNK * crypto_box_SECRETKEYBYTES];
+    SealPoolEntry *entry;
+    size_t         added = 0U;
+    size_t         missing;
+    size_t         n;
+    size_t         i;
+
+    for (;;) {
+        if (sodium_mutex_lock(&pool->lock) != 0) {
+            break; /* LCOV_EXCL_LINE */
+        }
+        missing = pool->capacity - pool->count;
+        sodium_mutex_unlock(&pool->lock);
+        if (max_keys > 0U && missing > max_keys - added) {
+            missing = max_keys - added;
+        }
+        if (missing == 0U) {
+            break;
+        }
+        n = missing < SEAL_POOL_REFILL_CHUNK ? missing : SEAL_POOL_REFILL_CHUNK;
+
+        /* key pairs are generated without holding the lock */
+        if (crypto_box_keypair_batch(pks, sks, n) != 0) {
+            break; /* LCOV_EXCL_LINE */
+        }
+        if (sodium_mutex_lock(&pool->lock) != 0) {
+            break; /* LCOV_EXCL_LINE */
+        }
+        for (i = 0U; i < n && pool->count < pool->capacity; i++) {
+            entry = &pool->entries[(pool->head + pool->count) % pool->capacity];
+            memcpy(entry->pk, pks + i * crypto_box_PUBLICKEYBYTES,
+                   crypto_box_PUBLICKEYBYTES);
+            memcpy(entry->sk, sks + i * crypto_box_SECRETKEYBYTES,
+                   crypto_box_SECRETKEYBYTES);
+            pool->count++;
+        }
+        sodium_mutex_unlock(&pool->lock);
+        added += i;
+        if (i < n) {
+            break;
+        }
+    }
+    sodium_memzero(sks, sizeof sks);
+
+    return added;
+}
+
+static int
+_crypto_box_seal_pool_take(crypto_box_seal_pool *pool,
+                           unsigned char *epk, unsigned char *esk)
+{
+    SealPoolEntry *entry;
+
+    if (sodium_mutex_lock(&pool->lock) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    if (pool->count == 0U) {
+        sodium_mutex_unlock(&pool->lock);
+        return -1;
+    }
+    entry = &pool->entries[pool->head];
+    memcpy(epk, entry->pk, crypto_box_PUBLICKEYBYTES);
+    memcpy(esk, entry->sk, crypto_box_SECRETKEYBYTES);
+    sodium_memzero(entry, sizeof *entry);
+    pool->head = (pool->head + 1U) % pool->capacity;
+    pool->count--;
+    sodium_mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+int
+crypto_box_seal_pooled(crypto_box_seal_pool *pool, unsigned char *c,
+                       const unsigned char *m, unsigned long long mlen,
+                       const unsigned char *pk)
+{
+    unsigned char epk[crypto_box_PUBLICKEYBYTES];
+    unsigned char esk[crypto_box_SECRETKEYBYTES];
+
+    if (pool == NULL || _crypto_box_seal_pool_take(pool, epk, esk) != 0) {
+        if (crypto_box_keypair(epk, esk) != 0) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+    }
+    return _crypto_box_seal(c, m, mlen, pk, epk, esk);
+}
+
 int
 crypto_box_seal_open(unsigned char *m, const unsigned char *c,
                      unsigned long long clen,
@@ -60,6 +230,143 @@ crypto_box_seal_open(unsigned char *m, const unsigned char *c,
                                 nonce, c, sk);
 }
 
+/*
+ * Multi-recipient sealed boxes:
+ *
+ * epk || LE32(n) || slot_0 || ... || slot_{n-1} || box(m, 0, key)
+ *
+ * with slot_i = hint_i || box(key, nonce_i, k_i),
+ * k_i = crypto_box_beforenm(pk_i, esk), nonce_i = H(epk || pk_i) like
+ * regular sealed boxes, and hint_i = H(nonce_i, k_i) truncated, so that a
+ * recipient can find its slot without trying to decrypt the other ones.
+ * The payload key is random and only used once, hence the zero nonce.
+ */
+
+static void
+_crypto_box_seal_multi_hint(unsigned char *hint, const unsigned char *nonce,
+                            const unsigned char *k)
+{
+    crypto_generichash(hint, SEAL_MULTI_HINTBYTES,
+                       nonce, crypto_box_NONCEBYTES,
+                       k, crypto_box_BEFORENMBYTES);
+}
+
+int
+crypto_box_seal_multi(unsigned char *c, const unsigned char *m,
+                      unsigned long long mlen,
+                      const unsigned char * const *pks, size_t npks)
+{
+    unsigned char  nonce[crypto_box_NONCEBYTES];
+    unsigned char  epk[crypto_box_PUBLICKEYBYTES];
+    unsigned char  esk[crypto_box_SECRETKEYBYTES];
+    unsigned char  k[crypto_box_BEFORENMBYTES];
+    unsigned char  key[crypto_box_BEFORENMBYTES];
+    unsigned char *slot;
+    size_t         i;
+    int            ret = -1;
+
+    (void) sizeof(int[crypto_box_SEALMULTI_SLOTBYTES ==
+                      SEAL_MULTI_HINTBYTES + crypto_box_BEFORENMBYTES +
+                      crypto_box_MACBYTES ? 1 : -1]);
+    if ((unsigned long long) npks > 0xffffffffULL ||
+        mlen > SIZE_MAX - crypto_box_MACBYTES) {
+        return -1;
+    }
+    if (crypto_box_keypair(epk, esk) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    randombytes_buf(key, sizeof key);
+    memcpy(c, epk, crypto_box_PUBLICKEYBYTES);
+    STORE32_LE(c + crypto_box_PUBLICKEYBYTES, (uint32_t) npks);
+    slot = c + crypto_box_SEALMULTI_HEADERBYTES;
+    for (i = 0U; i < npks; i++) {
+        if (crypto_box_beforenm(k, pks[i], esk) != 0) {
+            goto ret;
+        }
+        _crypto_box_seal_nonce(nonce, epk, pks[i]);
+        _crypto_box_seal_multi_hint(slot, nonce, k);
+        crypto_box_easy_afternm(slot + SEAL_MULTI_HINTBYTES, key, sizeof key,
+                                nonce, k);
+        slot += crypto_box_SEALMULTI_SLOTBYTES;
+    }
+    memset(nonce, 0, sizeof nonce);
+    ret = crypto_box_easy_afternm(slot, m, mlen, nonce, key);
+
+ret:
+    sodium_memzero(esk, sizeof esk);
+    sodium_memzero(k, sizeof k);
+    sodium_memzero(key, sizeof key);
+
+    return ret;
+}
+
+int
+crypto_box_seal_multi_open(unsigned char *m, unsigned long long *mlen_p,
+                           const unsigned char *c, unsigned long long clen,
+                           const unsigned char *pk, const unsigned char *sk)
+{
+    unsigned char        nonce[crypto_box_NONCEBYTES];
+    unsigned char        hint[SEAL_MULTI_HINTBYTES];
+    unsigned char        k[crypto_box_BEFORENMBYTES];
+    unsigned char        key[crypto_box_BEFORENMBYTES];
+    const unsigned char *slot;
+    unsigned long long   payload_offset;
+    uint32_t             npks;
+    uint32_t             i;
+    int                  ret = -1;
+
+    if (mlen_p != NULL) {
+        *mlen_p = 0U;
+    }
+    if (clen < crypto_box_SEALMULTI_HEADERBYTES) {
+        return -1;
+    }
+    npks = LOAD32_LE(c + crypto_box_PUBLICKEYBYTES);
+    payload_offset = crypto_box_SEALMULTI_HEADERBYTES +
+        (unsigned long long) npks * crypto_box_SEALMULTI_SLOTBYTES;
+    if (clen < payload_offset + crypto_box_MACBYTES) {
+        return -1;
+    }
+    if (crypto_box_beforenm(k, c, sk) != 0) {
+        return -1;
+    }
+    _crypto_box_seal_nonce(nonce, c, pk);
+    _crypto_box_seal_multi_hint(hint, nonce, k);
+    slot = c + crypto_box_SEALMULTI_HEADERBYTES;
+    for (i = 0U; i < npks; i++, slot += crypto_box_SEALMULTI_SLOTBYTES) {
+        if (sodium_memcmp(slot, hint, sizeof hint) == 0 &&
+            crypto_box_open_easy_afternm
+            (key, slot + SEAL_MULTI_HINTBYTES,
+             crypto_box_MACBYTES + sizeof key, nonce, k) == 0) {
+            break;
+        }
+    }
+    if (i < npks) {
+        memset(nonce, 0, sizeof nonce);
+        ret = crypto_box_open_easy_afternm(m, c + payload_offset,
+                                           clen - payload_offset, nonce, key);
+        if (ret == 0 && mlen_p != NULL) {
+            *mlen_p = clen - payload_offset - crypto_box_MACBYTES;
+        }
+    }
+    sodium_memzero(k, sizeof k);
+    sodium_memzero(key, sizeof key);
+
+    return ret;
+}
+
+size_t
+crypto_box_sealmulti_headerbytes(void)
+{
+    return crypto_box_SEALMULTI_HEADERBYTES;
+}
+
+size_t
+crypto_box_sealmulti_slotbytes(void)
+{
+    return crypto_box_SEALMULTI_SLOTBYTES;
+}
+
 size_t
 crypto_box_sealbytes(void)
 {
@@ -1,3 +1,4 @@
+#include <stdint.h>
 #include <string.h>
 
 #include "crypto_box_curve25519xsalsa20poly1305.h"
@@ -28,3 +29,37 @@ crypto_box_curve25519xsalsa20poly1305_keypair(unsigned char *pk,
 
     return crypto_scalarmult_curve25519_base(pk, sk);
 }
+
+int
+crypto_box_curve25519xsalsa20poly1305_seed_keypair_batch(unsigned char *pks,
+                                                         unsigned char *sks,
+                                                         const unsigned char *seeds,
+                                                         size_t n)
+{
+    unsigned char hash[64];
+    size_t        i;
+
+    if (n > SIZE_MAX / 32U) {
+        return -1;
+    }
+    for (i = 0U; i < n; i++) {
+        crypto_hash_sha512(hash, seeds + i * 32U, 32);
+        memmove(sks + i * 32U, hash, 32);
+    }
+    sodium_memzero(hash, sizeof hash);
+
+    return crypto_scalarmult_curve25519_base_batch(pks, sks, n);
+}
+
+int
+crypto_box_curve25519xsalsa20poly1305_keypair_batch(unsigned char *pks,
+                                                    unsigned char *sks,
+                                                    size_t n)
+{
+    if (n > SIZE_MAX / 32U) {
+        return -1;
+    }
+    randombytes_buf(sks, n * 32U);
+
+    return crypto_scalarmult_curve25519_base_batch(pks, sks, n);
+}
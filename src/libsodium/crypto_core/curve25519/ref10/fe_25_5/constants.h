@@ -0,0 +1,14 @@
+/* 37095705934669439343138083508754565189542113879843219016388785533085940283555 */
+static const fe d = {
+    -10913610,13857413,-15372611,6949391,114729,-8787816,-6275908,-3247719,-18696448,-12055116
+};
+
+/* 2 * d = 16295367250680780974490674513165176452449235426866156013048779062215315747161 */
+static const fe d2 = {
+    -21827239,-5839606,-30745221,13898782,229458,15978800,-12551817,-6495438,29715968,9444199
+};
+
+/* sqrt(-1) */
+static const fe sqrtm1 = {
+    -32595792,-7943725,9377950,3500415,12389472,-272473,-25146209,-2005654,326686,11406482
+};
@@ -0,0 +1,445 @@
+/*
+ fe means field element.
+ Here the field is \Z/(2^255-19).
+ An element t, entries t[0]...t[4], represents the integer
+ t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+ Limbs are unsigned; unless stated otherwise, each t[i] is below 2^54.
+ */
+
+typedef unsigned uint128_t __attribute__((mode(TI)));
+
+/*
+ h = 0
+ */
+
+void fe_0(fe h)
+{
+    memset(&h[0], 0, 5 * sizeof h[0]);
+}
+
+/*
+ h = 1
+ */
+
+void fe_1(fe h)
+{
+    h[0] = 1;
+    memset(&h[1], 0, 4 * sizeof h[0]);
+}
+
+/*
+ h = f + g
+ Can overlap h with f or g.
+ */
+
+void fe_add(fe h,const fe f,const fe g)
+{
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+}
+
+/*
+ h = f - g
+ Can overlap h with f or g.
+ *
+ g is carried first, so that adding 2*p to f is always enough
+ to keep every limb positive.
+ */
+
+void fe_sub(fe h,const fe f,const fe g)
+{
+    const uint64_t mask = 0x7ffffffffffffULL;
+    uint64_t h0, h1, h2, h3, h4;
+
+    h0 = g[0];
+    h1 = g[1];
+    h2 = g[2];
+    h3 = g[3];
+    h4 = g[4];
+
+    h1 += h0 >> 51;
+    h0 &= mask;
+    h2 += h1 >> 51;
+    h1 &= mask;
+    h3 += h2 >> 51;
+    h2 &= mask;
+    h4 += h3 >> 51;
+    h3 &= mask;
+    h0 += 19ULL * (h4 >> 51);
+    h4 &= mask;
+
+    h[0] = (f[0] + 0xfffffffffffdaULL) - h0;
+    h[1] = (f[1] + 0xffffffffffffeULL) - h1;
+    h[2] = (f[2] + 0xffffffffffffeULL) - h2;
+    h[3] = (f[3] + 0xffffffffffffeULL) - h3;
+    h[4] = (f[4] + 0xffffffffffffeULL) - h4;
+}
+
+/*
+ h = -f
+ */
+
+void fe_neg(fe h,const fe f)
+{
+    fe zero;
+
+    fe_0(zero);
+    fe_sub(h, zero, f);
+}
+
+/*
+ Replace (f,g) with (g,g) if b == 1;
+ replace (f,g) with (f,g) if b == 0.
+ *
+ Preconditions: b in {0,1}.
+ */
+
+void fe_cmov(fe f,const fe g,unsigned int b)
+{
+    const uint64_t mask = (uint64_t) (-(int64_t) b);
+    uint64_t x0, x1, x2, x3, x4;
+
+    x0 = f[0] ^ g[0];
+    x1 = f[1] ^ g[1];
+    x2 = f[2] ^ g[2];
+    x3 = f[3] ^ g[3];
+    x4 = f[4] ^ g[4];
+
+    x0 &= mask;
+    x1 &= mask;
+    x2 &= mask;
+    x3 &= mask;
+    x4 &= mask;
+
+    f[0] ^= x0;
+    f[1] ^= x1;
+    f[2] ^= x2;
+    f[3] ^= x3;
+    f[4] ^= x4;
+}
+
+/*
+ h = f
+ */
+
+void fe_copy(fe h,const fe f)
+{
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+/*
+ Ignores top bit of s.
+ */
+
+void fe_frombytes(fe h,const unsigned char *s)
+{
+    const uint64_t mask = 0x7ffffffffffffULL;
+
+    h[0] = (LOAD64_LE(s     )      ) & mask;
+    h[1] = (LOAD64_LE(s +  6) >>  3) & mask;
+    h[2] = (LOAD64_LE(s + 12) >>  6) & mask;
+    h[3] = (LOAD64_LE(s + 19) >>  1) & mask;
+    h[4] = (LOAD64_LE(s + 24) >> 12) & mask;
+}
+
+/*
+ h = f mod p, with 0 <= h < p
+ */
+
+static void fe_reduce(fe h,const fe f)
+{
+    const uint64_t mask = 0x7ffffffffffffULL;
+    uint64_t t0, t1, t2, t3, t4;
+
+    t0 = f[0];
+    t1 = f[1];
+    t2 = f[2];
+    t3 = f[3];
+    t4 = f[4];
+
+    t1 += t0 >> 51;
+    t0 &= mask;
+    t2 += t1 >> 51;
+    t1 &= mask;
+    t3 += t2 >> 51;
+    t2 &= mask;
+    t4 += t3 >> 51;
+    t3 &= mask;
+    t0 += 19ULL * (t4 >> 51);
+    t4 &= mask;
+
+    t1 += t0 >> 51;
+    t0 &= mask;
+    t2 += t1 >> 51;
+    t1 &= mask;
+    t3 += t2 >> 51;
+    t2 &= mask;
+    t4 += t3 >> 51;
+    t3 &= mask;
+    t0 += 19ULL * (t4 >> 51);
+    t4 &= mask;
+
+    /* now t is between 0 and 2^255-1, properly carried. */
+    /* case 1: between 0 and 2^255-20. case 2: between 2^255-19 and 2^255-1. */
+
+    t0 += 19ULL;
+
+    t1 += t0 >> 51;
+    t0 &= mask;
+    t2 += t1 >> 51;
+    t1 &= mask;
+    t3 += t2 >> 51;
+    t2 &= mask;
+    t4 += t3 >> 51;
+    t3 &= mask;
+    t0 += 19ULL * (t4 >> 51);
+    t4 &= mask;
+
+    /* now between 19 and 2^255-1 in both cases, and offset by 19. */
+
+    t0 += 0x8000000000000ULL - 19ULL;
+    t1 += 0x8000000000000ULL - 1ULL;
+    t2 += 0x8000000000000ULL - 1ULL;
+    t3 += 0x8000000000000ULL - 1ULL;
+    t4 += 0x8000000000000ULL - 1ULL;
+
+    /* now between 2^255 and 2^256-20, and offset by 2^255. */
+
+    t1 += t0 >> 51;
+    t0 &= mask;
+    t2 += t1 >> 51;
+    t1 &= mask;
+    t3 += t2 >> 51;
+    t2 &= mask;
+    t4 += t3 >> 51;
+    t3 &= mask;
+    t4 &= mask;
+
+    h[0] = t0;
+    h[1] = t1;
+    h[2] = t2;
+    h[3] = t3;
+    h[4] = t4;
+}
+
+void fe_tobytes(unsigned char *s,const fe h)
+{
+    fe       t;
+    uint64_t t0, t1, t2, t3;
+
+    fe_reduce(t, h);
+    t0 = t[0] | (t[1] << 51);
+    t1 = (t[1] >> 13) | (t[2] << 38);
+    t2 = (t[2] >> 26) | (t[3] << 25);
+    t3 = (t[3] >> 39) | (t[4] << 12);
+    STORE64_LE(s +  0, t0);
+    STORE64_LE(s +  8, t1);
+    STORE64_LE(s + 16, t2);
+    STORE64_LE(s + 24, t3);
+}
+
+/*
+ h = f * g
+ Can overlap h with f or g.
+ *
+ Postconditions:
+ h[0] < 2^51 + 2^14, other limbs < 2^51 + 2^13
+ */
+
+void fe_mul(fe h,const fe f,const fe g)
+{
+    const uint64_t mask = 0x7ffffffffffffULL;
+    uint128_t r0, r1, r2, r3, r4, carry;
+    uint64_t  f0, f1, f2, f3, f4;
+    uint64_t  f1_19, f2_19, f3_19, f4_19;
+    uint64_t  g0, g1, g2, g3, g4;
+    uint64_t  r00, r01, r02, r03, r04;
+
+    f0 = f[0];
+    f1 = f[1];
+    f2 = f[2];
+    f3 = f[3];
+    f4 = f[4];
+
+    g0 = g[0];
+    g1 = g[1];
+    g2 = g[2];
+    g3 = g[3];
+    g4 = g[4];
+
+    f1_19 = 19ULL * f1;
+    f2_19 = 19ULL * f2;
+    f3_19 = 19ULL * f3;
+    f4_19 = 19ULL * f4;
+
+    r0  = ((uint128_t) f0   ) * ((uint128_t) g0);
+    r0 += ((uint128_t) f1_19) * ((uint128_t) g4);
+    r0 += ((uint128_t) f2_19) * ((uint128_t) g3);
+    r0 += ((uint128_t) f3_19) * ((uint128_t) g2);
+    r0 += ((uint128_t) f4_19) * ((uint128_t) g1);
+
+    r1  = ((uint128_t) f0   ) * ((uint128_t) g1);
+    r1 += ((uint128_t) f1   ) * ((uint128_t) g0);
+    r1 += ((uint128_t) f2_19) * ((uint128_t) g4);
+    r1 += ((uint128_t) f3_19) * ((uint128_t) g3);
+    r1 += ((uint128_t) f4_19) * ((uint128_t) g2);
+
+    r2  = ((uint128_t) f0   ) * ((uint128_t) g2);
+    r2 += ((uint128_t) f1   ) * ((uint128_t) g1);
+    r2 += ((uint128_t) f2   ) * ((uint128_t) g0);
+    r2 += ((uint128_t) f3_19) * ((uint128_t) g4);
+    r2 += ((uint128_t) f4_19) * ((uint128_t) g3);
+
+    r3  = ((uint128_t) f0   ) * ((uint128_t) g3);
+    r3 += ((uint128_t) f1   ) * ((uint128_t) g2);
+    r3 += ((uint128_t) f2   ) * ((uint128_t) g1);
+    r3 += ((uint128_t) f3   ) * ((uint128_t) g0);
+    r3 += ((uint128_t) f4_19) * ((uint128_t) g4);
+
+    r4  = ((uint128_t) f0   ) * ((uint128_t) g4);
+    r4 += ((uint128_t) f1   ) * ((uint128_t) g3);
+    r4 += ((uint128_t) f2   ) * ((uint128_t) g2);
+    r4 += ((uint128_t) f3   ) * ((uint128_t) g1);
+    r4 += ((uint128_t) f4   ) * ((uint128_t) g0);
+
+    r00    = ((uint64_t) r0) & mask;
+    carry  = r0 >> 51;
+    r1    += carry;
+    r01    = ((uint64_t) r1) & mask;
+    carry  = r1 >> 51;
+    r2    += carry;
+    r02    = ((uint64_t) r2) & mask;
+    carry  = r2 >> 51;
+    r3    += carry;
+    r03    = ((uint64_t) r3) & mask;
+    carry  = r3 >> 51;
+    r4    += carry;
+    r04    = ((uint64_t) r4) & mask;
+    carry  = r4 >> 51;
+    r00   += 19ULL * (uint64_t) carry;
+    carry  = r00 >> 51;
+    r00   &= mask;
+    r01   += (uint64_t) carry;
+    carry  = r01 >> 51;
+    r01   &= mask;
+    r02   += (uint64_t) carry;
+
+    h[0] = r00;
+    h[1] = r01;
+    h[2] = r02;
+    h[3] = r03;
+    h[4] = r04;
+}
+
+/*
+ h = f * f, or 2 * f * f if dbl is set
+ Can overlap h with f.
+ */
+
+static inline void fe_sqn(fe h,const fe f,const int dbl)
+{
+    const uint64_t mask = 0x7ffffffffffffULL;
+    uint128_t r0, r1, r2, r3, r4, carry;
+    uint64_t  f0, f1, f2, f3, f4;
+    uint64_t  f0_2, f1_2, f1_38, f2_38, f3_38, f3_19, f4_19;
+    uint64_t  r00, r01, r02, r03, r04;
+
+    f0 = f[0];
+    f1 = f[1];
+    f2 = f[2];
+    f3 = f[3];
+    f4 = f[4];
+
+    f0_2 = f0 << 1;
+    f1_2 = f1 << 1;
+
+    f1_38 = 38ULL * f1;
+    f2_38 = 38ULL * f2;
+    f3_38 = 38ULL * f3;
+
+    f3_19 = 19ULL * f3;
+    f4_19 = 19ULL * f4;
+
+    r0  = ((uint128_t) f0   ) * ((uint128_t) f0);
+    r0 += ((uint128_t) f1_38) * ((uint128_t) f4);
+    r0 += ((uint128_t) f2_38) * ((uint128_t) f3);
+
+    r1  = ((uint128_t) f0_2 ) * ((uint128_t) f1);
+    r1 += ((uint128_t) f2_38) * ((uint128_t) f4);
+    r1 += ((uint128_t) f3_19) * ((uint128_t) f3);
+
+    r2  = ((uint128_t) f0_2 ) * ((uint128_t) f2);
+    r2 += ((uint128_t) f1   ) * ((uint128_t) f1);
+    r2 += ((uint128_t) f3_38) * ((uint128_t) f4);
+
+    r3  = ((uint128_t) f0_2 ) * ((uint128_t) f3);
+    r3 += ((uint128_t) f1_2 ) * ((uint128_t) f2);
+    r3 += ((uint128_t) f4_19) * ((uint128_t) f4);
+
+    r4  = ((uint128_t) f0_2 ) * ((uint128_t) f4);
+    r4 += ((uint128_t) f1_2 ) * ((uint128_t) f3);
+    r4 += ((uint128_t) f2   ) * ((uint128_t) f2);
+
+    if (dbl) {
+        r0 <<= 1;
+        r1 <<= 1;
+        r2 <<= 1;
+        r3 <<= 1;
+        r4 <<= 1;
+    }
+
+    r00    = ((uint64_t) r0) & mask;
+    carry  = r0 >> 51;
+    r1    += carry;
+    r01    = ((uint64_t) r1) & mask;
+    carry  = r1 >> 51;
+    r2    += carry;
+    r02    = ((uint64_t) r2) & mask;
+    carry  = r2 >> 51;
+    r3    += carry;
+    r03    = ((uint64_t) r3) & mask;
+    carry  = r3 >> 51;
+    r4    += carry;
+    r04    = ((uint64_t) r4) & mask;
+    carry  = r4 >> 51;
+    r00   += 19ULL * (uint64_t) carry;
+    carry  = r00 >> 51;
+    r00   &= mask;
+    r01   += (uint64_t) carry;
+    carry  = r01 >> 51;
+    r01   &= mask;
+    r02   += (uint64_t) carry;
+
+    h[0] = r00;
+    h[1] = r01;
+    h[2] = r02;
+    h[3] = r03;
+    h[4] = r04;
+}
+
+/*
+ h = f * f
+ Can overlap h with f.
+ */
+
+void fe_sq(fe h,const fe f)
+{
+    fe_sqn(h, f, 0);
+}
+
+/*
+ h = 2 * f * f
+ Can overlap h with f.
+ */
+
+void fe_sq2(fe h,const fe f)
+{
+    fe_sqn(h, f, 1);
+}
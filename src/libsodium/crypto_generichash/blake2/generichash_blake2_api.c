@@ -1,4 +1,6 @@
 #include "crypto_generichash_blake2b.h"
+#include "crypto_generichash_blake2bp.h"
+#include "crypto_generichash_blake2s.h"
 
 size_t
 crypto_generichash_blake2b_bytes_min(void) {
@@ -46,3 +48,87 @@ crypto_generichash_blake2b_statebytes(void)
     return (sizeof(crypto_generichash_blake2b_state) + (size_t) 63U)
         & ~(size_t) 63U;
 }
+
+size_t
+crypto_generichash_blake2s_bytes_min(void) {
+    return crypto_generichash_blake2s_BYTES_MIN;
+}
+
+size_t
+crypto_generichash_blake2s_bytes_max(void) {
+    return crypto_generichash_blake2s_BYTES_MAX;
+}
+
+size_t
+crypto_generichash_blake2s_bytes(void) {
+    return crypto_generichash_blake2s_BYTES;
+}
+
+size_t
+crypto_generichash_blake2s_keybytes_min(void) {
+    return crypto_generichash_blake2s_KEYBYTES_MIN;
+}
+
+size_t
+crypto_generichash_blake2s_keybytes_max(void) {
+    return crypto_generichash_blake2s_KEYBYTES_MAX;
+}
+
+size_t
+crypto_generichash_blake2s_keybytes(void) {
+    return crypto_generichash_blake2s_KEYBYTES;
+}
+
+size_t
+crypto_generichash_blake2s_saltbytes(void) {
+    return crypto_generichash_blake2s_SALTBYTES;
+}
+
+size_t
+crypto_generichash_blake2s_personalbytes(void) {
+    return crypto_generichash_blake2s_PERSONALBYTES;
+}
+
+size_t
+crypto_generichash_blake2s_statebytes(void)
+{
+    return (sizeof(crypto_generichash_blake2s_state) + (size_t) 63U)
+        & ~(size_t) 63U;
+}
+
+size_t
+crypto_generichash_blake2bp_bytes_min(void) {
+    return crypto_generichash_blake2bp_BYTES_MIN;
+}
+
+size_t
+crypto_generichash_blake2bp_bytes_max(void) {
+    return crypto_generichash_blake2bp_BYTES_MAX;
+}
+
+size_t
+crypto_generichash_blake2bp_bytes(void) {
+    return crypto_generichash_blake2bp_BYTES;
+}
+
+size_t
+crypto_generichash_blake2bp_keybytes_min(void) {
+    return crypto_generichash_blake2bp_KEYBYTES_MIN;
+}
+
+size_t
+crypto_generichash_blake2bp_keybytes_max(void) {
+    return crypto_generichash_blake2bp_KEYBYTES_MAX;
+}
+
+size_t
+crypto_generichash_blake2bp_keybytes(void) {
+    return crypto_generichash_blake2bp_KEYBYTES;
+}
+
+size_t
+crypto_generichash_blake2bp_statebytes(void)
+{
+    return (sizeof(crypto_generichash_blake2bp_state) + (size_t) 63U)
+        & ~(size_t) 63U;
+}
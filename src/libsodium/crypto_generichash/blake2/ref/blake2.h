@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include "crypto_generichash_blake2b.h"
+#include "crypto_generichash_blake2s.h"
 #include "export.h"
 
 #define blake2b_init_param               crypto_generichash_blake2b__init_param
@@ -33,6 +34,19 @@
 #define blake2b                          crypto_generichash_blake2b__blake2b
 #define blake2b_salt_personal            crypto_generichash_blake2b__blake2b_salt_personal
 #define blake2b_pick_best_implementation crypto_generichash_blake2b__pick_best_implementation
+#define blake2b_multi                    crypto_generichash_blake2b__multi
+#define blake2b_prepare                  crypto_generichash_blake2b__prepare
+
+#define blake2s_init_param               crypto_generichash_blake2s__init_param
+#define blake2s_init                     crypto_generichash_blake2s__init
+#define blake2s_init_salt_personal       crypto_generichash_blake2s__init_salt_personal
+#define blake2s_init_key                 crypto_generichash_blake2s__init_key
+#define blake2s_init_key_salt_personal   crypto_generichash_blake2s__init_key_salt_personal
+#define blake2s_update                   crypto_generichash_blake2s__update
+#define blake2s_final                    crypto_generichash_blake2s__final
+#define blake2s                          crypto_generichash_blake2s__blake2s
+#define blake2s_salt_personal            crypto_generichash_blake2s__blake2s_salt_personal
+#define blake2s_pick_best_implementation crypto_generichash_blake2s__pick_best_implementation
 
 enum blake2b_constant
 {
@@ -43,6 +57,15 @@ enum blake2b_constant
   BLAKE2B_PERSONALBYTES = 16
 };
 
+enum blake2s_constant
+{
+  BLAKE2S_BLOCKBYTES = 64,
+  BLAKE2S_OUTBYTES   = 32,
+  BLAKE2S_KEYBYTES   = 32,
+  BLAKE2S_SALTBYTES  = 8,
+  BLAKE2S_PERSONALBYTES = 8
+};
+
 #if defined(__IBMC__) || defined(__SUNPRO_C) || defined(__SUNPRO_CC)
 # pragma pack(1)
 #else
@@ -66,6 +89,22 @@ typedef struct blake2b_param_
 
 typedef crypto_generichash_blake2b_state blake2b_state;
 
+typedef struct blake2s_param_
+{
+  uint8_t  digest_length;  /*  1 */
+  uint8_t  key_length;     /*  2 */
+  uint8_t  fanout;         /*  3 */
+  uint8_t  depth;          /*  4 */
+  uint8_t  leaf_length[4]; /*  8 */
+  uint8_t  node_offset[6]; /* 14 */
+  uint8_t  node_depth;     /* 15 */
+  uint8_t  inner_length;   /* 16 */
+  uint8_t  salt[BLAKE2S_SALTBYTES]; /* 24 */
+  uint8_t  personal[BLAKE2S_PERSONALBYTES];  /* 32 */
+} blake2s_param;
+
+typedef crypto_generichash_blake2s_state blake2s_state;
+
 #if defined(__IBMC__) || defined(__SUNPRO_C) || defined(__SUNPRO_CC)
 # pragma pack()
 #else
@@ -82,10 +121,12 @@ int blake2b_init_key_salt_personal( blake2b_state *S, const uint8_t outlen, cons
 int blake2b_init_param( blake2b_state *S, const blake2b_param *P );
 int blake2b_update( blake2b_state *S, const uint8_t *in, uint64_t inlen );
 int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen );
+int blake2b_prepare( blake2b_state *S );
 
 /* Simple API */
 int blake2b( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen );
 int blake2b_salt_personal( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen, const void *salt, const void *personal );
+int blake2b_multi( uint8_t * const *out, const uint8_t outlen, const uint8_t * const *in, const unsigned long long *inlen, const void *key, uint8_t keylen, size_t n );
 
 typedef int ( *blake2b_compress_fn )( blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKBYTES] );
 int blake2b_pick_best_implementation(void);
@@ -94,4 +135,29 @@ int blake2b_compress_ssse3( blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKB
 int blake2b_compress_sse41( blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKBYTES] );
 int blake2b_compress_avx2( blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKBYTES] );
 
+typedef int ( *blake2b_compress4_fn )( uint64_t h[32], const uint64_t t[8], const uint64_t f[8],
+                                       const uint8_t * const blocks[4] );
+int blake2b_compress4_avx2( uint64_t h[32], const uint64_t t[8], const uint64_t f[8],
+                            const uint8_t * const blocks[4] );
+
+/* BLAKE2s */
+int blake2s_init( blake2s_state *S, const uint8_t outlen );
+int blake2s_init_salt_personal( blake2s_state *S, const uint8_t outlen,
+                                const void *salt, const void *personal );
+int blake2s_init_key( blake2s_state *S, const uint8_t outlen, const void *key, const uint8_t keylen );
+int blake2s_init_key_salt_personal( blake2s_state *S, const uint8_t outlen, const void *key, const uint8_t keylen,
+                                    const void *salt, const void *personal );
+int blake2s_init_param( blake2s_state *S, const blake2s_param *P );
+int blake2s_update( blake2s_state *S, const uint8_t *in, uint64_t inlen );
+int blake2s_final( blake2s_state *S, uint8_t *out, uint8_t outlen );
+
+int blake2s( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen );
+int blake2s_salt_personal( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen, const void *salt, const void *personal );
+
+typedef int ( *blake2s_compress_fn )( blake2s_state *S, const uint8_t block[BLAKE2S_BLOCKBYTES] );
+int blake2s_pick_best_implementation(void);
+int blake2s_compress_ref( blake2s_state *S, const uint8_t block[BLAKE2S_BLOCKBYTES] );
+int blake2s_compress_ssse3( blake2s_state *S, const uint8_t block[BLAKE2S_BLOCKBYTES] );
+int blake2s_compress_sse41( blake2s_state *S, const uint8_t block[BLAKE2S_BLOCKBYTES] );
+
 #endif
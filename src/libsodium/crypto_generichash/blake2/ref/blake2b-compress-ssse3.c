@@ -17,6 +17,7 @@
 #include "blake2.h"
 #include "blake2-impl.h"
 #include "blake2b-compress-ssse3.h"
+#include "private/common.h"
 
 CRYPTO_ALIGN(64) static const uint64_t blake2b_IV[8] =
 {
@@ -36,22 +37,22 @@ int blake2b_compress_ssse3( blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKB
   __m128i t0, t1;
   const __m128i r16 = _mm_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
   const __m128i r24 = _mm_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
-  const uint64_t  m0 = ( ( uint64_t * )block )[ 0];
-  const uint64_t  m1 = ( ( uint64_t * )block )[ 1];
-  const uint64_t  m2 = ( ( uint64_t * )block )[ 2];
-  const uint64_t  m3 = ( ( uint64_t * )block )[ 3];
-  const uint64_t  m4 = ( ( uint64_t * )block )[ 4];
-  const uint64_t  m5 = ( ( uint64_t * )block )[ 5];
-  const uint64_t  m6 = ( ( uint64_t * )block )[ 6];
-  const uint64_t  m7 = ( ( uint64_t * )block )[ 7];
-  const uint64_t  m8 = ( ( uint64_t * )block )[ 8];
-  const uint64_t  m9 = ( ( uint64_t * )block )[ 9];
-  const uint64_t m10 = ( ( uint64_t * )block )[10];
-  const uint64_t m11 = ( ( uint64_t * )block )[11];
-  const uint64_t m12 = ( ( uint64_t * )block )[12];
-  const uint64_t m13 = ( ( uint64_t * )block )[13];
-  const uint64_t m14 = ( ( uint64_t * )block )[14];
-  const uint64_t m15 = ( ( uint64_t * )block )[15];
+  const uint64_t  m0 = LOAD64_LE( block +  0 * 8 );
+  const uint64_t  m1 = LOAD64_LE( block +  1 * 8 );
+  const uint64_t  m2 = LOAD64_LE( block +  2 * 8 );
+  const uint64_t  m3 = LOAD64_LE( block +  3 * 8 );
+  const uint64_t  m4 = LOAD64_LE( block +  4 * 8 );
+  const uint64_t  m5 = LOAD64_LE( block +  5 * 8 );
+  const uint64_t  m6 = LOAD64_LE( block +  6 * 8 );
+  const uint64_t  m7 = LOAD64_LE( block +  7 * 8 );
+  const uint64_t  m8 = LOAD64_LE( block +  8 * 8 );
+  const uint64_t  m9 = LOAD64_LE( block +  9 * 8 );
+  const uint64_t m10 = LOAD64_LE( block + 10 * 8 );
+  const uint64_t m11 = LOAD64_LE( block + 11 * 8 );
+  const uint64_t m12 = LOAD64_LE( block + 12 * 8 );
+  const uint64_t m13 = LOAD64_LE( block + 13 * 8 );
+  const uint64_t m14 = LOAD64_LE( block + 14 * 8 );
+  const uint64_t m15 = LOAD64_LE( block + 15 * 8 );
 
   row1l = LOADU( &S->h[0] );
   row1h = LOADU( &S->h[2] );
@@ -0,0 +1,125 @@
+
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+#pragma GCC target("sse4.1")
+#pragma GCC target("avx2")
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <smmintrin.h>
+#include <immintrin.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+#include "blake2b-compress-avx2.h"
+
+CRYPTO_ALIGN(64) static const uint64_t blake2b_IV[8] =
+{
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+    0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint8_t blake2b_sigma[12][16] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 } ,
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 } ,
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 } ,
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 } ,
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 } ,
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 } ,
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 } ,
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 } ,
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0 } ,
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
+};
+
+#define G4(r, i, a, b, c, d)                        \
+    do {                                            \
+        a = ADD(ADD(a, m[blake2b_sigma[r][2 * i + 0]]), b); \
+        d = ROT32(XOR(d, a));                       \
+        c = ADD(c, d);                              \
+        b = ROT24(XOR(b, c));                       \
+        a = ADD(ADD(a, m[blake2b_sigma[r][2 * i + 1]]), b); \
+        d = ROT16(XOR(d, a));                       \
+        c = ADD(c, d);                              \
+        b = ROT63(XOR(b, c));                       \
+    } while (0)
+
+#define ROUND4(r)                                   \
+    do {                                            \
+        G4(r, 0, v[0], v[4], v[8], v[12]);          \
+        G4(r, 1, v[1], v[5], v[9], v[13]);          \
+        G4(r, 2, v[2], v[6], v[10], v[14]);         \
+        G4(r, 3, v[3], v[7], v[11], v[15]);         \
+        G4(r, 4, v[0], v[5], v[10], v[15]);         \
+        G4(r, 5, v[1], v[6], v[11], v[12]);         \
+        G4(r, 6, v[2], v[7], v[8], v[13]);          \
+        G4(r, 7, v[3], v[4], v[9], v[14]);          \
+    } while (0)
+
+/*
+ * One block for each of four independent states. Every vector holds the
+ * same word of the four states: h[w * 4 + l] is word w of lane l, and
+ * likewise for the counters t[] and the finalization flags f[].
+ */
+int blake2b_compress4_avx2( uint64_t h[32], const uint64_t t[8], const uint64_t f[8],
+                            const uint8_t * const blocks[4] )
+{
+    __m256i m[16];
+    __m256i v[16];
+    __m256i r[4], s[4];
+    int     i;
+
+    for (i = 0; i < 16; i += 4) {
+        r[0] = LOADU(blocks[0] + i * 8);
+        r[1] = LOADU(blocks[1] + i * 8);
+        r[2] = LOADU(blocks[2] + i * 8);
+        r[3] = LOADU(blocks[3] + i * 8);
+        s[0] = _mm256_unpacklo_epi64(r[0], r[1]);
+        s[1] = _mm256_unpackhi_epi64(r[0], r[1]);
+        s[2] = _mm256_unpacklo_epi64(r[2], r[3]);
+        s[3] = _mm256_unpackhi_epi64(r[2], r[3]);
+        m[i + 0] = _mm256_permute2x128_si256(s[0], s[2], 0x20);
+        m[i + 1] = _mm256_permute2x128_si256(s[1], s[3], 0x20);
+        m[i + 2] = _mm256_permute2x128_si256(s[0], s[2], 0x31);
+        m[i + 3] = _mm256_permute2x128_si256(s[1], s[3], 0x31);
+    }
+    for (i = 0; i < 8; i++) {
+        v[i] = LOADU(&h[i * 4]);
+        v[i + 8] = _mm256_set1_epi64x((long long) blake2b_IV[i]);
+    }
+    v[12] = XOR(v[12], LOADU(&t[0]));
+    v[13] = XOR(v[13], LOADU(&t[4]));
+    v[14] = XOR(v[14], LOADU(&f[0]));
+    v[15] = XOR(v[15], LOADU(&f[4]));
+
+    ROUND4(0);
+    ROUND4(1);
+    ROUND4(2);
+    ROUND4(3);
+    ROUND4(4);
+    ROUND4(5);
+    ROUND4(6);
+    ROUND4(7);
+    ROUND4(8);
+    ROUND4(9);
+    ROUND4(10);
+    ROUND4(11);
+
+    for (i = 0; i < 8; i++) {
+        STOREU(&h[i * 4], XOR(LOADU(&h[i * 4]), XOR(v[i], v[i + 8])));
+    }
+    return 0;
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "blake2.h"
 #include "blake2-impl.h"
 #include "runtime.h"
+#include "utils.h"
 #include "private/common.h"
 
 #ifdef HAVE_TI_MODE
@@ -30,6 +31,7 @@ typedef unsigned uint128_t __attribute__ ((mode(TI)));
 #endif
 
 static blake2b_compress_fn blake2b_compress = blake2b_compress_ref;
+static blake2b_compress4_fn blake2b_compress4 = NULL;
 
 static const uint64_t blake2b_IV[8] =
 {
@@ -297,36 +299,59 @@ int blake2b_init_key_salt_personal( blake2b_state *S, const uint8_t outlen, cons
 }
 
 /* inlen now in bytes */
+/*
+ * Full blocks are compressed straight from the input. Only the last block
+ * seen so far is kept in S->buf, since it may turn out to be the final one.
+ */
 int blake2b_update( blake2b_state *S, const uint8_t *in, uint64_t inlen )
 {
-  while( inlen > 0 )
-  {
-    size_t left = S->buflen;
-    size_t fill = 2 * BLAKE2B_BLOCKBYTES - left;
+  size_t left;
+  size_t fill;
 
-    if( inlen > fill )
+  if( inlen == 0 )
+    return 0;
+  left = S->buflen;
+  assert( left <= BLAKE2B_BLOCKBYTES );
+  fill = BLAKE2B_BLOCKBYTES - left;
+  if( inlen > fill )
+  {
+    memcpy( S->buf + left, in, fill ); /* Complete the buffered block */
+    blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
+    blake2b_compress( S, S->buf );
+    in += fill;
+    inlen -= fill;
+    left = 0;
+    while( inlen > BLAKE2B_BLOCKBYTES )
     {
-      memcpy( S->buf + left, in, fill ); /* Fill buffer */
-      S->buflen += fill;
       blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
-      blake2b_compress( S, S->buf ); /* Compress */
-      memcpy( S->buf, S->buf + BLAKE2B_BLOCKBYTES, BLAKE2B_BLOCKBYTES ); /* Shift buffer left */
-      S->buflen -= BLAKE2B_BLOCKBYTES;
-      in += fill;
-      inlen -= fill;
-    }
-    else /* inlen <= fill */
-    {
-      memcpy( S->buf + left, in, inlen );
-      S->buflen += inlen; /* Be lazy, do not compress */
-      in += inlen;
-      inlen -= inlen;
+      blake2b_compress( S, in );
+      in += BLAKE2B_BLOCKBYTES;
+      inlen -= BLAKE2B_BLOCKBYTES;
     }
   }
+  memcpy( S->buf + left, in, ( size_t )inlen );
+  S->buflen = left + ( size_t )inlen;
 
   return 0;
 }
 
+/*
+ * Compresses the key block of a freshly keyed state, so that copies of the
+ * state can start hashing messages right away. The key block and the
+ * state before compression are kept in S->buf, which is not otherwise used
+ * past the first block, in case the message turns out to be empty.
+ */
+int blake2b_prepare( blake2b_state *S )
+{
+  if( S->buflen != BLAKE2B_BLOCKBYTES || S->t[0] != 0 || S->t[1] != 0 )
+    return -1;
+  memcpy( S->buf + BLAKE2B_BLOCKBYTES, S->h, sizeof S->h );
+  blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
+  blake2b_compress( S, S->buf );
+  S->buflen = 0;
+  return 0;
+}
+
 int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen )
 {
   if( !outlen || outlen > BLAKE2B_OUTBYTES ) {
@@ -335,6 +360,13 @@ int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen )
   if( blake2b_is_lastblock( S ) ) {
     return -1;
   }
+  if( S->buflen == 0 && S->t[0] == BLAKE2B_BLOCKBYTES && S->t[1] == 0 )
+  {
+    /* Prepared state and empty message: the key block is the last block */
+    memcpy( S->h, S->buf + BLAKE2B_BLOCKBYTES, sizeof S->h );
+    S->t[0] = 0;
+    S->buflen = BLAKE2B_BLOCKBYTES;
+  }
   if( S->buflen > BLAKE2B_BLOCKBYTES )
   {
     blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
@@ -424,14 +456,174 @@ int blake2b_salt_personal( uint8_t *out, const void *in, const void *key, const
   return 0;
 }
 
+/* Multi-buffer API */
+typedef struct blake2b_lane_
+{
+  const uint8_t *in;
+  uint64_t       left;
+  size_t         msg;
+  int            active;
+} blake2b_lane;
+
+static void blake2b_multi_lane_load( blake2b_lane *L, uint64_t h[32], uint64_t t[8], size_t l,
+                                     const blake2b_state *S0, const uint8_t *in, uint64_t inlen,
+                                     size_t msg )
+{
+  size_t i;
+
+  for( i = 0; i < 8; ++i )
+    h[i * 4 + l] = S0->h[i];
+  t[l] = S0->t[0];
+  t[4 + l] = S0->t[1];
+  L->in = in;
+  L->left = inlen;
+  L->msg = msg;
+  L->active = 1;
+}
+
+static int blake2b_multi_scalar( uint8_t * const *out, const uint8_t outlen, const uint8_t * const *in,
+                                 const unsigned long long *inlen, size_t n, const blake2b_state *S0 )
+{
+  blake2b_state S[1];
+  size_t        i;
+
+  for( i = 0; i < n; ++i )
+  {
+    memcpy( S, S0, sizeof S[0] );
+    if( NULL == in[i] && inlen[i] > 0 ) abort();
+    blake2b_update( S, in[i], ( uint64_t )inlen[i] );
+    blake2b_final( S, out[i], outlen );
+  }
+  sodium_memzero( S, sizeof S );
+  return 0;
+}
+
+/*
+ * Hashes n independent messages, four at a time, one message per 64-bit
+ * lane. A lane that finishes its message is refilled with the next one
+ * right away, so that messages of different lengths can be mixed.
+ */
+int blake2b_multi( uint8_t * const *out, const uint8_t outlen, const uint8_t * const *in,
+                   const unsigned long long *inlen, const void *key, uint8_t keylen, size_t n )
+{
+  CRYPTO_ALIGN(64) uint64_t h[32];
+  uint64_t       t[8];
+  uint64_t       f[8];
+  CRYPTO_ALIGN(64) uint8_t pad[4][BLAKE2B_BLOCKBYTES];
+  uint8_t        buffer[BLAKE2B_OUTBYTES];
+  const uint8_t *blocks[4];
+  blake2b_lane   lanes[4];
+  blake2b_state  S0[1];
+  blake2b_state  SK[1];
+  size_t         next = 0;
+  size_t         l;
+  size_t         i;
+  int            active;
+
+  if( NULL == out && n > 0 ) abort();
+
+  if( !outlen || outlen > BLAKE2B_OUTBYTES ) abort();
+
+  if( NULL == key && keylen > 0 ) abort();
+
+  if( keylen > BLAKE2B_KEYBYTES ) abort();
+
+  if( keylen > 0 )
+  {
+    if( blake2b_init_key( S0, outlen, key, keylen ) < 0 ) abort();
+  }
+  else
+  {
+    if( blake2b_init( S0, outlen ) < 0 ) abort();
+  }
+  if( blake2b_compress4 == NULL || n < 2 )
+  {
+    blake2b_multi_scalar( out, outlen, in, inlen, n, S0 );
+    sodium_memzero( S0, sizeof S0 );
+    return 0;
+  }
+  /* SK: the key block compressed once, shared by all non-empty messages */
+  memcpy( SK, S0, sizeof SK[0] );
+  if( keylen > 0 )
+    blake2b_prepare( SK );
+  memset( lanes, 0, sizeof lanes );
+  memset( h, 0, sizeof h );
+  memset( t, 0, sizeof t );
+  for( ;; )
+  {
+    active = 0;
+    for( l = 0; l < 4; ++l )
+    {
+      if( !lanes[l].active && next < n )
+      {
+        if( NULL == in[next] && inlen[next] > 0 ) abort();
+        if( keylen > 0 && inlen[next] == 0 )
+          blake2b_multi_lane_load( &lanes[l], h, t, l, S0, S0->buf, BLAKE2B_BLOCKBYTES, next );
+        else
+          blake2b_multi_lane_load( &lanes[l], h, t, l, SK, in[next], ( uint64_t )inlen[next], next );
+        next++;
+      }
+      if( !lanes[l].active )
+      {
+        memset( pad[l], 0, BLAKE2B_BLOCKBYTES );
+        blocks[l] = pad[l];
+        f[l] = 0;
+        continue;
+      }
+      active = 1;
+      if( lanes[l].left > BLAKE2B_BLOCKBYTES )
+      {
+        blocks[l] = lanes[l].in;
+        lanes[l].in += BLAKE2B_BLOCKBYTES;
+        lanes[l].left -= BLAKE2B_BLOCKBYTES;
+        t[l] += BLAKE2B_BLOCKBYTES;
+        t[4 + l] += ( t[l] < BLAKE2B_BLOCKBYTES );
+        f[l] = 0;
+      }
+      else
+      {
+        memset( pad[l], 0, BLAKE2B_BLOCKBYTES );
+        if( lanes[l].left > 0 )
+          memcpy( pad[l], lanes[l].in, ( size_t )lanes[l].left );
+        blocks[l] = pad[l];
+        t[l] += lanes[l].left;
+        t[4 + l] += ( t[l] < lanes[l].left );
+        lanes[l].left = 0;
+        f[l] = ( uint64_t )-1;
+      }
+      f[4 + l] = 0;
+    }
+    if( !active )
+      break;
+    blake2b_compress4( h, t, f, blocks );
+    for( l = 0; l < 4; ++l )
+    {
+      if( !lanes[l].active || f[l] == 0 )
+        continue;
+      for( i = 0; i < 8; ++i )
+        STORE64_LE( buffer + sizeof( h[0] ) * i, h[i * 4 + l] );
+      memcpy( out[lanes[l].msg], buffer, outlen );
+      lanes[l].active = 0;
+    }
+  }
+  sodium_memzero( h, sizeof h );
+  sodium_memzero( pad, sizeof pad );
+  sodium_memzero( buffer, sizeof buffer );
+  sodium_memzero( S0, sizeof S0 );
+  sodium_memzero( SK, sizeof SK );
+  return 0;
+}
+
 int
 blake2b_pick_best_implementation(void)
 {
 /* LCOV_EXCL_START */
+  blake2b_compress4 = NULL;
 #if (defined(HAVE_AVX2INTRIN_H) && defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)) || \
     (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
   if (sodium_runtime_has_avx2()) {
     blake2b_compress = blake2b_compress_avx2;
+    blake2b_compress4 = blake2b_compress4_avx2;
     return 0;
   }
 #endif
@@ -0,0 +1,67 @@
+
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(HAVE_EMMINTRIN_H) && defined(HAVE_TMMINTRIN_H)) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)))
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+#include "blake2s-compress-ssse3.h"
+#include "private/common.h"
+
+CRYPTO_ALIGN(16) static const uint32_t blake2s_IV[8] =
+{
+  0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+  0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL
+};
+
+int blake2s_compress_ssse3( blake2s_state *S, const uint8_t block[BLAKE2S_BLOCKBYTES] )
+{
+  __m128i row1, row2, row3, row4;
+  __m128i buf;
+  __m128i ff0, ff1;
+  const __m128i r8 = _mm_setr_epi8( 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 );
+  const __m128i r16 = _mm_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 );
+  const int m0 = (int) LOAD32_LE( block +  0 );
+  const int m1 = (int) LOAD32_LE( block +  4 );
+  const int m2 = (int) LOAD32_LE( block +  8 );
+  const int m3 = (int) LOAD32_LE( block + 12 );
+  const int m4 = (int) LOAD32_LE( block + 16 );
+  const int m5 = (int) LOAD32_LE( block + 20 );
+  const int m6 = (int) LOAD32_LE( block + 24 );
+  const int m7 = (int) LOAD32_LE( block + 28 );
+  const int m8 = (int) LOAD32_LE( block + 32 );
+  const int m9 = (int) LOAD32_LE( block + 36 );
+  const int m10 = (int) LOAD32_LE( block + 40 );
+  const int m11 = (int) LOAD32_LE( block + 44 );
+  const int m12 = (int) LOAD32_LE( block + 48 );
+  const int m13 = (int) LOAD32_LE( block + 52 );
+  const int m14 = (int) LOAD32_LE( block + 56 );
+  const int m15 = (int) LOAD32_LE( block + 60 );
+  row1 = ff0 = LOADU( &S->h[0] );
+  row2 = ff1 = LOADU( &S->h[4] );
+  row3 = LOADU( &blake2s_IV[0] );
+  row4 = _mm_xor_si128( LOADU( &blake2s_IV[4] ), LOADU( &S->t[0] ) );
+  ROUND( 0 );
+  ROUND( 1 );
+  ROUND( 2 );
+  ROUND( 3 );
+  ROUND( 4 );
+  ROUND( 5 );
+  ROUND( 6 );
+  ROUND( 7 );
+  ROUND( 8 );
+  ROUND( 9 );
+  STOREU( &S->h[0], _mm_xor_si128( ff0, _mm_xor_si128( row1, row3 ) ) );
+  STOREU( &S->h[4], _mm_xor_si128( ff1, _mm_xor_si128( row2, row4 ) ) );
+  return 0;
+}
+
+#endif
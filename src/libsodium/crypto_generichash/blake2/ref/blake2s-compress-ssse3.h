@@ -0,0 +1,54 @@
+#ifndef blake2s_compress_ssse3_H
+#define blake2s_compress_ssse3_H
+
+#define LOADU(p)  _mm_loadu_si128( (const __m128i *)(const void *)(p) )
+#define STOREU(p,r) _mm_storeu_si128((__m128i *)(void *)(p), r)
+#define TOF(reg) _mm_castsi128_ps((reg))
+#define TOI(reg) _mm_castps_si128((reg))
+
+#define _mm_roti_epi32(x, c) \
+    (-(c) == 16) ? _mm_shuffle_epi8((x), r16) \
+    : (-(c) == 8) ? _mm_shuffle_epi8((x), r8) \
+    : _mm_xor_si128(_mm_srli_epi32((x), -(c)), _mm_slli_epi32((x), 32-(-(c))))
+
+#define G1(row1,row2,row3,row4,buf) \
+  row1 = _mm_add_epi32(_mm_add_epi32(row1, buf), row2); \
+  row4 = _mm_xor_si128(row4, row1); \
+  row4 = _mm_roti_epi32(row4, -16); \
+  row3 = _mm_add_epi32(row3, row4); \
+  row2 = _mm_xor_si128(row2, row3); \
+  row2 = _mm_roti_epi32(row2, -12);
+
+#define G2(row1,row2,row3,row4,buf) \
+  row1 = _mm_add_epi32(_mm_add_epi32(row1, buf), row2); \
+  row4 = _mm_xor_si128(row4, row1); \
+  row4 = _mm_roti_epi32(row4, -8); \
+  row3 = _mm_add_epi32(row3, row4); \
+  row2 = _mm_xor_si128(row2, row3); \
+  row2 = _mm_roti_epi32(row2, -7);
+
+#define DIAGONALIZE(row1,row2,row3,row4) \
+  row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(0,3,2,1)); \
+  row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1,0,3,2)); \
+  row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(2,1,0,3));
+
+#define UNDIAGONALIZE(row1,row2,row3,row4) \
+  row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(2,1,0,3)); \
+  row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1,0,3,2)); \
+  row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(0,3,2,1));
+
+#include "blake2s-load-sse2.h"
+
+#define ROUND(r) \
+  LOAD_MSG_ ##r ##_1(buf); \
+  G1(row1,row2,row3,row4,buf); \
+  LOAD_MSG_ ##r ##_2(buf); \
+  G2(row1,row2,row3,row4,buf); \
+  DIAGONALIZE(row1,row2,row3,row4); \
+  LOAD_MSG_ ##r ##_3(buf); \
+  G1(row1,row2,row3,row4,buf); \
+  LOAD_MSG_ ##r ##_4(buf); \
+  G2(row1,row2,row3,row4,buf); \
+  UNDIAGONALIZE(row1,row2,row3,row4);
+
+#endif
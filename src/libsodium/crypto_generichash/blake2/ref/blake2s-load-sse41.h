@@ -0,0 +1,370 @@
+/*
+   BLAKE2 reference source code package - optimized C implementations
+
+   Written in 2012 by Samuel Neves <sneves@dei.uc.pt>
+
+   To the extent possible under law, the author(s) have dedicated all copyright
+   and related and neighboring rights to this software to the public domain
+   worldwide. This software is distributed without any warranty.
+
+   You should have received a copy of the CC0 Public Domain Dedication along with
+   this software. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+*/
+
+#ifndef blake2s_load_sse41_H
+#define blake2s_load_sse41_H
+
+#define LOAD_MSG_0_1(buf) \
+do \
+{ \
+buf = TOI(_mm_shuffle_ps(TOF(m0), TOF(m1), _MM_SHUFFLE(2,0,2,0))); \
+} while(0)
+
+
+#define LOAD_MSG_0_2(buf) \
+do \
+{ \
+buf = TOI(_mm_shuffle_ps(TOF(m0), TOF(m1), _MM_SHUFFLE(3,1,3,1))); \
+} while(0)
+
+
+#define LOAD_MSG_0_3(buf) \
+do \
+{ \
+buf = TOI(_mm_shuffle_ps(TOF(m2), TOF(m3), _MM_SHUFFLE(2,0,2,0))); \
+} while(0)
+
+
+#define LOAD_MSG_0_4(buf) \
+do \
+{ \
+buf = TOI(_mm_shuffle_ps(TOF(m2), TOF(m3), _MM_SHUFFLE(3,1,3,1))); \
+} while(0)
+
+
+#define LOAD_MSG_1_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,0,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_1_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,0,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(2,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_1_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,0,1)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(1,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_1_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,2,0)); \
+buf = _mm_blend_epi16(buf, m3, 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_2_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,0,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,3)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_2_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,0,0)); \
+buf = _mm_blend_epi16(buf, m2, 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_2_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_2_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(0,2,2,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,2)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_3_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,3)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, m2, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_3_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(2,0,1,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,1)), 0x03); \
+buf = _mm_blend_epi16(buf, m0, 0x0C); \
+} while(0)
+
+
+#define LOAD_MSG_3_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,0,1,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,2)), 0x03); \
+buf = _mm_blend_epi16(buf, m3, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_3_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,2,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,2)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,0,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_4_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,1)); \
+buf = _mm_blend_epi16(buf, m1, 0x0C); \
+buf = _mm_blend_epi16(buf, m0, 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_4_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,0,3,0)); \
+buf = _mm_blend_epi16(buf, m0, 0x03); \
+buf = _mm_blend_epi16(buf, m3, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_4_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,3,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, m1, 0x30); \
+buf = _mm_blend_epi16(buf, m0, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_4_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,0,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,1)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,0,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_5_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,0,1,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,2,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_5_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,2,0)); \
+buf = _mm_blend_epi16(buf, m3, 0x03); \
+buf = _mm_blend_epi16(buf, m0, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_5_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,3,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(1,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_5_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,1)); \
+buf = _mm_blend_epi16(buf, m1, 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_6_1(buf) \
+do \
+{ \
+buf = m3; \
+buf = _mm_blend_epi16(buf, m0, 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(0,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_6_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,1,3,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,1)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_6_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,1,1,0)); \
+buf = _mm_blend_epi16(buf, m0, 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,2,0)), 0x0C); \
+} while(0)
+
+
+#define LOAD_MSG_6_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,3)), 0x03); \
+buf = _mm_blend_epi16(buf, m2, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_7_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,0,1,1)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,3,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, m0, 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_7_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,3)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,2,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_7_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,1)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,3,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,0,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(2,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_7_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,0,0)); \
+buf = _mm_blend_epi16(buf, m0, 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_8_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,2,0)), 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(0,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_8_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,1,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,3)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_8_3(buf) \
+do \
+{ \
+buf = m3; \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_8_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(1,0,3,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,2)), 0x03); \
+} while(0)
+
+
+#define LOAD_MSG_9_1(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,0,2)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(1,2,1,0)), 0xC0); \
+} while(0)
+
+
+#define LOAD_MSG_9_2(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m1, _MM_SHUFFLE(1,2,0,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,2)), 0x03); \
+} while(0)
+
+
+#define LOAD_MSG_9_3(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,3)); \
+buf = _mm_blend_epi16(buf, m2, 0x0C); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,3,1,0)), 0x30); \
+} while(0)
+
+
+#define LOAD_MSG_9_4(buf) \
+do \
+{ \
+buf = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,0,2,0)); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,3)), 0x03); \
+buf = _mm_blend_epi16(buf, _mm_shuffle_epi32(m0, _MM_SHUFFLE(0,2,1,0)), 0xC0); \
+} while(0)
+
+#endif
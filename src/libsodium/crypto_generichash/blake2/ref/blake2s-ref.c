@@ -0,0 +1,430 @@
+/*
+   BLAKE2 reference source code package - C implementations
+
+   Written in 2012 by Samuel Neves <sneves@dei.uc.pt>
+
+   To the extent possible under law, the author(s) have dedicated all copyright
+   and related and neighboring rights to this software to the public domain
+   worldwide. This software is distributed without any warranty.
+
+   You should have received a copy of the CC0 Public Domain Dedication along with
+   this software. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+#include "runtime.h"
+#include "private/common.h"
+
+static blake2s_compress_fn blake2s_compress = blake2s_compress_ref;
+
+static const uint32_t blake2s_IV[8] =
+{
+  0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+  0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL
+};
+
+/* LCOV_EXCL_START */
+static inline int blake2s_set_lastnode( blake2s_state *S )
+{
+  S->f[1] = -1;
+  return 0;
+}
+/* LCOV_EXCL_STOP */
+#if 0
+static inline int blake2s_clear_lastnode( blake2s_state *S )
+{
+  S->f[1] = 0;
+  return 0;
+}
+#endif
+
+static inline int blake2s_is_lastblock( const blake2s_state *S )
+{
+  return S->f[0] != 0;
+}
+
+static inline int blake2s_set_lastblock( blake2s_state *S )
+{
+  if( S->last_node ) blake2s_set_lastnode( S );
+
+  S->f[0] = -1;
+  return 0;
+}
+#if 0
+static inline int blake2s_clear_lastblock( blake2s_state *S )
+{
+  if( S->last_node ) blake2s_clear_lastnode( S );
+
+  S->f[0] = 0;
+  return 0;
+}
+#endif
+static inline int blake2s_increment_counter( blake2s_state *S, const uint32_t inc )
+{
+  S->t[0] += inc;
+  S->t[1] += ( S->t[0] < inc );
+  return 0;
+}
+
+/* Parameter-related functions */
+#if 0
+/* Redundant: digest length is directly set in blake2s_init(), blake2s_init_salt_personal(),
+ * blake2s_init_key() and blake2s_init_key_salt_personal() */
+static inline int blake2s_param_set_digest_length( blake2s_param *P, const uint8_t digest_length )
+{
+  P->digest_length = digest_length;
+  return 0;
+}
+
+static inline int blake2s_param_set_fanout( blake2s_param *P, const uint8_t fanout )
+{
+  P->fanout = fanout;
+  return 0;
+}
+
+static inline int blake2s_param_set_max_depth( blake2s_param *P, const uint8_t depth )
+{
+  P->depth = depth;
+  return 0;
+}
+
+static inline int blake2s_param_set_leaf_length( blake2s_param *P, const uint32_t leaf_length )
+{
+  STORE32_LE( P->leaf_length, leaf_length );
+  return 0;
+}
+
+static inline int blake2s_param_set_node_offset( blake2s_param *P, const uint64_t node_offset )
+{
+  STORE32_LE( P->node_offset, (uint32_t) node_offset );
+  P->node_offset[4] = (uint8_t) ( node_offset >> 32 );
+  P->node_offset[5] = (uint8_t) ( node_offset >> 40 );
+  return 0;
+}
+
+static inline int blake2s_param_set_node_depth( blake2s_param *P, const uint8_t node_depth )
+{
+  P->node_depth = node_depth;
+  return 0;
+}
+
+static inline int blake2s_param_set_inner_length( blake2s_param *P, const uint8_t inner_length )
+{
+  P->inner_length = inner_length;
+  return 0;
+}
+#endif
+static inline int blake2s_param_set_salt( blake2s_param *P, const uint8_t salt[BLAKE2S_SALTBYTES] )
+{
+  memcpy( P->salt, salt, BLAKE2S_SALTBYTES );
+  return 0;
+}
+
+static inline int blake2s_param_set_personal( blake2s_param *P, const uint8_t personal[BLAKE2S_PERSONALBYTES] )
+{
+  memcpy( P->personal, personal, BLAKE2S_PERSONALBYTES );
+  return 0;
+}
+
+static inline int blake2s_init0( blake2s_state *S )
+{
+  int i;
+  memset( S, 0, sizeof( blake2s_state ) );
+
+  for( i = 0; i < 8; ++i ) S->h[i] = blake2s_IV[i];
+
+  return 0;
+}
+
+/* init xors IV with input parameter block */
+int blake2s_init_param( blake2s_state *S, const blake2s_param *P )
+{
+  size_t i;
+  const uint8_t *p;
+
+  (void) sizeof(int[sizeof *P == 32 ? 1 : -1]);
+  blake2s_init0( S );
+  p = ( const uint8_t * )( P );
+
+  /* IV XOR ParamBlock */
+  for( i = 0; i < 8; ++i )
+    S->h[i] ^= LOAD32_LE( p + sizeof( S->h[i] ) * i );
+
+  return 0;
+}
+
+int blake2s_init( blake2s_state *S, const uint8_t outlen )
+{
+  blake2s_param P[1];
+
+  if ( ( !outlen ) || ( outlen > BLAKE2S_OUTBYTES ) ) abort();
+
+  P->digest_length = outlen;
+  P->key_length    = 0;
+  P->fanout        = 1;
+  P->depth         = 1;
+  STORE32_LE( P->leaf_length, 0 );
+  memset( P->node_offset, 0, sizeof( P->node_offset ) );
+  P->node_depth    = 0;
+  P->inner_length  = 0;
+  memset( P->salt,     0, sizeof( P->salt ) );
+  memset( P->personal, 0, sizeof( P->personal ) );
+  return blake2s_init_param( S, P );
+}
+
+int blake2s_init_salt_personal( blake2s_state *S, const uint8_t outlen,
+                                const void *salt, const void *personal )
+{
+  blake2s_param P[1];
+
+  if ( ( !outlen ) || ( outlen > BLAKE2S_OUTBYTES ) ) abort();
+
+  P->digest_length = outlen;
+  P->key_length    = 0;
+  P->fanout        = 1;
+  P->depth         = 1;
+  STORE32_LE( P->leaf_length, 0 );
+  memset( P->node_offset, 0, sizeof( P->node_offset ) );
+  P->node_depth    = 0;
+  P->inner_length  = 0;
+  if (salt != NULL) {
+    blake2s_param_set_salt( P, (const uint8_t *) salt );
+  } else {
+    memset( P->salt, 0, sizeof( P->salt ) );
+  }
+  if (personal != NULL) {
+    blake2s_param_set_personal( P, (const uint8_t *) personal );
+  } else {
+    memset( P->personal, 0, sizeof( P->personal ) );
+  }
+  return blake2s_init_param( S, P );
+}
+
+int blake2s_init_key( blake2s_state *S, const uint8_t outlen, const void *key, const uint8_t keylen )
+{
+  blake2s_param P[1];
+
+  if ( ( !outlen ) || ( outlen > BLAKE2S_OUTBYTES ) ) abort();
+
+  if ( !key || !keylen || keylen > BLAKE2S_KEYBYTES ) abort();
+
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = 1;
+  P->depth         = 1;
+  STORE32_LE( P->leaf_length, 0 );
+  memset( P->node_offset, 0, sizeof( P->node_offset ) );
+  P->node_depth    = 0;
+  P->inner_length  = 0;
+  memset( P->salt,     0, sizeof( P->salt ) );
+  memset( P->personal, 0, sizeof( P->personal ) );
+
+  if( blake2s_init_param( S, P ) < 0 ) abort();
+
+  {
+    uint8_t block[BLAKE2S_BLOCKBYTES];
+    memset( block, 0, BLAKE2S_BLOCKBYTES );
+    memcpy( block, key, keylen );
+    blake2s_update( S, block, BLAKE2S_BLOCKBYTES );
+    secure_zero_memory( block, BLAKE2S_BLOCKBYTES ); /* Burn the key from stack */
+  }
+  return 0;
+}
+
+int blake2s_init_key_salt_personal( blake2s_state *S, const uint8_t outlen, const void *key, const uint8_t keylen,
+                                    const void *salt, const void *personal )
+{
+  blake2s_param P[1];
+
+  if ( ( !outlen ) || ( outlen > BLAKE2S_OUTBYTES ) ) abort();
+
+  if ( !key || !keylen || keylen > BLAKE2S_KEYBYTES ) abort();
+
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = 1;
+  P->depth         = 1;
+  STORE32_LE( P->leaf_length, 0 );
+  memset( P->node_offset, 0, sizeof( P->node_offset ) );
+  P->node_depth    = 0;
+  P->inner_length  = 0;
+  if (salt != NULL) {
+    blake2s_param_set_salt( P, (const uint8_t *) salt );
+  } else {
+    memset( P->salt, 0, sizeof( P->salt ) );
+  }
+  if (personal != NULL) {
+    blake2s_param_set_personal( P, (const uint8_t *) personal );
+  } else {
+    memset( P->personal, 0, sizeof( P->personal ) );
+  }
+
+  if( blake2s_init_param( S, P ) < 0 ) abort();
+
+  {
+    uint8_t block[BLAKE2S_BLOCKBYTES];
+    memset( block, 0, BLAKE2S_BLOCKBYTES );
+    memcpy( block, key, keylen );
+    blake2s_update( S, block, BLAKE2S_BLOCKBYTES );
+    secure_zero_memory( block, BLAKE2S_BLOCKBYTES ); /* Burn the key from stack */
+  }
+  return 0;
+}
+
+/* inlen now in bytes */
+int blake2s_update( blake2s_state *S, const uint8_t *in, uint64_t inlen )
+{
+  while( inlen > 0 )
+  {
+    size_t left = S->buflen;
+    size_t fill = 2 * BLAKE2S_BLOCKBYTES - left;
+
+    if( inlen > fill )
+    {
+      memcpy( S->buf + left, in, fill ); /* Fill buffer */
+      S->buflen += fill;
+      blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
+      blake2s_compress( S, S->buf ); /* Compress */
+      memcpy( S->buf, S->buf + BLAKE2S_BLOCKBYTES, BLAKE2S_BLOCKBYTES ); /* Shift buffer left */
+      S->buflen -= BLAKE2S_BLOCKBYTES;
+      in += fill;
+      inlen -= fill;
+    }
+    else /* inlen <= fill */
+    {
+      memcpy( S->buf + left, in, inlen );
+      S->buflen += inlen; /* Be lazy, do not compress */
+      in += inlen;
+      inlen -= inlen;
+    }
+  }
+
+  return 0;
+}
+
+int blake2s_final( blake2s_state *S, uint8_t *out, uint8_t outlen )
+{
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) {
+    abort(); /* LCOV_EXCL_LINE */
+  }
+  if( blake2s_is_lastblock( S ) ) {
+    return -1;
+  }
+  if( S->buflen > BLAKE2S_BLOCKBYTES )
+  {
+    blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
+    blake2s_compress( S, S->buf );
+    S->buflen -= BLAKE2S_BLOCKBYTES;
+    assert( S->buflen <= BLAKE2S_BLOCKBYTES );
+    memcpy( S->buf, S->buf + BLAKE2S_BLOCKBYTES, S->buflen );
+  }
+
+  blake2s_increment_counter( S, ( uint32_t ) S->buflen );
+  blake2s_set_lastblock( S );
+  memset( S->buf + S->buflen, 0, 2 * BLAKE2S_BLOCKBYTES - S->buflen ); /* Padding */
+  blake2s_compress( S, S->buf );
+
+#ifdef NATIVE_LITTLE_ENDIAN
+  memcpy( out, &S->h[0], outlen );
+#else
+  {
+    uint8_t buffer[BLAKE2S_OUTBYTES];
+    int     i;
+
+    for( i = 0; i < 8; ++i ) /* Output full hash to temp buffer */
+      STORE32_LE( buffer + sizeof( S->h[i] ) * i, S->h[i] );
+    memcpy( out, buffer, outlen );
+  }
+#endif
+  return 0;
+}
+
+/* inlen, at least, should be uint64_t. Others can be size_t. */
+int blake2s( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen )
+{
+  blake2s_state S[1];
+
+  /* Verify parameters */
+  if( NULL == in && inlen > 0 ) abort();
+
+  if( NULL == out ) abort();
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) abort();
+
+  if( NULL == key && keylen > 0 ) abort();
+
+  if( keylen > BLAKE2S_KEYBYTES ) abort();
+
+  if( keylen > 0 )
+  {
+    if( blake2s_init_key( S, outlen, key, keylen ) < 0 ) abort();
+  }
+  else
+  {
+    if( blake2s_init( S, outlen ) < 0 ) abort();
+  }
+
+  blake2s_update( S, ( const uint8_t * )in, inlen );
+  blake2s_final( S, out, outlen );
+  return 0;
+}
+
+int blake2s_salt_personal( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen,
+                           const void *salt, const void *personal )
+{
+  blake2s_state S[1];
+
+  /* Verify parameters */
+  if( NULL == in && inlen > 0 ) abort();
+
+  if( NULL == out ) abort();
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) abort();
+
+  if( NULL == key && keylen > 0 ) abort();
+
+  if( keylen > BLAKE2S_KEYBYTES ) abort();
+
+  if( keylen > 0 )
+  {
+    if( blake2s_init_key_salt_personal( S, outlen, key, keylen, salt, personal ) < 0 ) abort();
+  }
+  else
+  {
+    if( blake2s_init_salt_personal( S, outlen, salt, personal ) < 0 ) abort();
+  }
+
+  blake2s_update( S, ( const uint8_t * )in, inlen );
+  blake2s_final( S, out, outlen );
+  return 0;
+}
+
+int
+blake2s_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+#if (defined(HAVE_EMMINTRIN_H) && defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)))
+  if (sodium_runtime_has_sse41()) {
+    blake2s_compress = blake2s_compress_sse41;
+    return 0;
+  }
+#endif
+#if (defined(HAVE_EMMINTRIN_H) && defined(HAVE_TMMINTRIN_H)) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)))
+  if (sodium_runtime_has_ssse3()) {
+    blake2s_compress = blake2s_compress_ssse3;
+    return 0;
+  }
+#endif
+  blake2s_compress = blake2s_compress_ref;
+
+  return 0;
+/* LCOV_EXCL_STOP */
+}
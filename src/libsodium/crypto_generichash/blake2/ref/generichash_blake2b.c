@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "crypto_generichash_blake2b.h"
 #include "blake2.h"
@@ -41,6 +42,32 @@ crypto_generichash_blake2b_salt_personal(unsigned char *out, size_t outlen,
                                  salt, personal);
 }
 
+int
+crypto_generichash_blake2b_multi(unsigned char * const *out, size_t outlen,
+                                 const unsigned char * const *in,
+                                 const unsigned long long *inlen,
+                                 const unsigned char *key, size_t keylen,
+                                 size_t n)
+{
+    size_t i;
+
+    if (outlen <= 0U || outlen > BLAKE2B_OUTBYTES ||
+        keylen > BLAKE2B_KEYBYTES) {
+        return -1;
+    }
+    for (i = 0U; i < n; i++) {
+        if (inlen[i] > UINT64_MAX) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+
+    return blake2b_multi((uint8_t * const *) out, (uint8_t) outlen,
+                         (const uint8_t * const *) in, inlen,
+                         key, (uint8_t) keylen, n);
+}
+
 int
 crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
                                 const unsigned char *key,
@@ -107,6 +134,39 @@ crypto_generichash_blake2b_final(crypto_generichash_blake2b_state *state,
     return blake2b_final(state, (uint8_t *) out, (uint8_t) outlen);
 }
 
+int
+crypto_generichash_blake2b_keyed_prepare(crypto_generichash_blake2b_state *state,
+                                         const unsigned char *key,
+                                         const size_t keylen, const size_t outlen)
+{
+    return crypto_generichash_blake2b_keyed_prepare_salt_personal
+        (state, key, keylen, outlen, NULL, NULL);
+}
+
+int
+crypto_generichash_blake2b_keyed_prepare_salt_personal(crypto_generichash_blake2b_state *state,
+                                                       const unsigned char *key,
+                                                       const size_t keylen, const size_t outlen,
+                                                       const unsigned char *salt,
+                                                       const unsigned char *personal)
+{
+    if (crypto_generichash_blake2b_init_salt_personal(state, key, keylen, outlen,
+                                                      salt, personal) != 0) {
+        return -1;
+    }
+    if (key != NULL && keylen > 0U) {
+        (void) blake2b_prepare(state);
+    }
+    return 0;
+}
+
+void
+crypto_generichash_blake2b_reset(crypto_generichash_blake2b_state *state,
+                                 const crypto_generichash_blake2b_state *prepared)
+{
+    memcpy(state, prepared, sizeof *state);
+}
+
 int
 _crypto_generichash_blake2b_pick_best_implementation(void)
 {
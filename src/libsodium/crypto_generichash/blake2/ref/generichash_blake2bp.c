@@ -0,0 +1,307 @@
+
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto_generichash_blake2bp.h"
+#include "blake2.h"
+#include "blake2-impl.h"
+#include "utils.h"
+#include "private/common.h"
+#include "private/thread.h"
+
+#define BLAKE2BP_LEAVES 4U
+#define BLAKE2BP_STRIPE (BLAKE2BP_LEAVES * BLAKE2B_BLOCKBYTES)
+
+/* Below this size, starting threads costs more than it saves */
+#define BLAKE2BP_THREADS_MIN_BYTES (256U * 1024U)
+
+/* The layout behind the opaque crypto_generichash_blake2bp_state */
+typedef struct BLAKE2bpState_ {
+    blake2b_state leaves[BLAKE2BP_LEAVES];
+    blake2b_state root;
+    uint8_t       buf[BLAKE2BP_STRIPE];
+    size_t        buflen;
+    size_t        outlen;
+} BLAKE2bpState;
+
+#define COMPILER_ASSERT(X) (void) sizeof(char[(X) ? 1 : -1])
+
+static BLAKE2bpState *
+blake2bp_state(crypto_generichash_blake2bp_state *state)
+{
+    COMPILER_ASSERT(sizeof(BLAKE2bpState) <= sizeof state->opaque);
+    return (BLAKE2bpState *) (void *) state->opaque;
+}
+
+typedef struct BLAKE2bpLeaves_ {
+    blake2b_state *leaves;
+    uint8_t      (*hashes)[BLAKE2B_OUTBYTES];
+    const uint8_t *in;
+    uint64_t       inlen;
+    size_t         first;
+    size_t         count;
+} BLAKE2bpLeaves;
+
+static void
+blake2bp_init_node(blake2b_state *S, uint8_t outlen, uint8_t keylen,
+                   uint64_t node_offset, uint8_t node_depth)
+{
+    blake2b_param P[1];
+
+    P->digest_length = outlen;
+    P->key_length    = keylen;
+    P->fanout        = BLAKE2BP_LEAVES;
+    P->depth         = 2;
+    STORE32_LE(P->leaf_length, 0);
+    STORE64_LE(P->node_offset, node_offset);
+    P->node_depth    = node_depth;
+    P->inner_length  = BLAKE2B_OUTBYTES;
+    memset(P->reserved, 0, sizeof P->reserved);
+    memset(P->salt, 0, sizeof P->salt);
+    memset(P->personal, 0, sizeof P->personal);
+    blake2b_init_param(S, P);
+}
+
+static void
+blake2bp_init(blake2b_state leaves[BLAKE2BP_LEAVES], blake2b_state *root,
+              uint8_t outlen, const uint8_t *key, uint8_t keylen)
+{
+    uint8_t block[BLAKE2B_BLOCKBYTES];
+    size_t  i;
+
+    blake2bp_init_node(root, outlen, keylen, 0U, 1U);
+    root->last_node = 1;
+    for (i = 0U; i < BLAKE2BP_LEAVES; i++) {
+        blake2bp_init_node(&leaves[i], outlen, keylen, (uint64_t) i, 0U);
+    }
+    leaves[BLAKE2BP_LEAVES - 1U].last_node = 1;
+    if (keylen > 0U) {
+        memset(block, 0, sizeof block);
+        memcpy(block, key, keylen);
+        for (i = 0U; i < BLAKE2BP_LEAVES; i++) {
+            blake2b_update(&leaves[i], block, BLAKE2B_BLOCKBYTES);
+        }
+        sodium_memzero(block, sizeof block);
+    }
+}
+
+/* Absorbs every full stripe of `in` into the leaves [first, first + count) */
+static void
+blake2bp_leaves_update(blake2b_state leaves[BLAKE2BP_LEAVES],
+                       const uint8_t *in, uint64_t inlen,
+                       size_t first, size_t count)
+{
+    const uint8_t *leaf_in;
+    uint64_t       leaf_inlen;
+    size_t         i;
+
+    for (i = first; i < first + count; i++) {
+        leaf_in = in + i * BLAKE2B_BLOCKBYTES;
+        leaf_inlen = inlen;
+        while (leaf_inlen >= BLAKE2BP_STRIPE) {
+            blake2b_update(&leaves[i], leaf_in, BLAKE2B_BLOCKBYTES);
+            leaf_in += BLAKE2BP_STRIPE;
+            leaf_inlen -= BLAKE2BP_STRIPE;
+        }
+    }
+}
+
+/* Absorbs the final partial stripe (inlen < BLAKE2BP_STRIPE) and finalizes */
+static void
+blake2bp_leaves_final(blake2b_state leaves[BLAKE2BP_LEAVES],
+                      uint8_t hashes[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES],
+                      const uint8_t *in, size_t inlen,
+                      size_t first, size_t count)
+{
+    size_t i;
+    size_t left;
+
+    for (i = first; i < first + count; i++) {
+        if (inlen > i * BLAKE2B_BLOCKBYTES) {
+            left = inlen - i * BLAKE2B_BLOCKBYTES;
+            if (left > BLAKE2B_BLOCKBYTES) {
+                left = BLAKE2B_BLOCKBYTES;
+            }
+            blake2b_update(&leaves[i], in + i * BLAKE2B_BLOCKBYTES, left);
+        }
+        blake2b_final(&leaves[i], hashes[i], BLAKE2B_OUTBYTES);
+    }
+}
+
+static void
+blake2bp_root_final(blake2b_state *root,
+                    uint8_t hashes[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES],
+                    uint8_t *out, uint8_t outlen)
+{
+    size_t i;
+
+    for (i = 0U; i < BLAKE2BP_LEAVES; i++) {
+        blake2b_update(root, hashes[i], BLAKE2B_OUTBYTES);
+    }
+    blake2b_final(root, out, outlen);
+}
+
+static void
+blake2bp_leaves_job(void *job_)
+{
+    BLAKE2bpLeaves *job = (BLAKE2bpLeaves *) job_;
+    uint64_t        tail = job->inlen % BLAKE2BP_STRIPE;
+
+    blake2bp_leaves_update(job->leaves, job->in, job->inlen,
+                           job->first, job->count);
+    blake2bp_leaves_final(job->leaves, job->hashes,
+                          job->in + (job->inlen - tail), (size_t) tail,
+                          job->first, job->count);
+}
+
+int
+crypto_generichash_blake2bp_threaded(unsigned char *out, size_t outlen,
+                                     const unsigned char *in,
+                                     unsigned long long inlen,
+                                     const unsigned char *key, size_t keylen,
+                                     size_t threads)
+{
+    blake2b_state   leaves[BLAKE2BP_LEAVES];
+    blake2b_state   root;
+    uint8_t         hashes[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES];
+    BLAKE2bpLeaves  jobs[BLAKE2BP_LEAVES];
+    sodium_thread_t workers[BLAKE2BP_LEAVES];
+    int             started[BLAKE2BP_LEAVES];
+    size_t          i;
+    size_t          leaves_per_job;
+    size_t          njobs;
+
+    if (outlen <= 0U || outlen > BLAKE2B_OUTBYTES ||
+        keylen > BLAKE2B_KEYBYTES || inlen > UINT64_MAX ||
+        (key == NULL && keylen > 0U)) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+    blake2bp_init(leaves, &root, (uint8_t) outlen, key, (uint8_t) keylen);
+
+    if (threads >= BLAKE2BP_LEAVES) {
+        njobs = BLAKE2BP_LEAVES;
+    } else if (threads >= 2U) {
+        njobs = 2U;
+    } else {
+        njobs = 1U;
+    }
+    if (inlen < BLAKE2BP_THREADS_MIN_BYTES) {
+        njobs = 1U;
+    }
+    leaves_per_job = BLAKE2BP_LEAVES / njobs;
+    for (i = 0U; i < njobs; i++) {
+        jobs[i].leaves = leaves;
+        jobs[i].hashes = hashes;
+        jobs[i].in = in;
+        jobs[i].inlen = (uint64_t) inlen;
+        jobs[i].first = i * leaves_per_job;
+        jobs[i].count = leaves_per_job;
+    }
+    /* the calling thread takes the first job */
+    for (i = 1U; i < njobs; i++) {
+        started[i] = sodium_thread_create(&workers[i], blake2bp_leaves_job,
+                                          &jobs[i]) == 0;
+        if (!started[i]) {
+            blake2bp_leaves_job(&jobs[i]); /* LCOV_EXCL_LINE */
+        }
+    }
+    blake2bp_leaves_job(&jobs[0]);
+    for (i = 1U; i < njobs; i++) {
+        if (started[i]) {
+            sodium_thread_join(&workers[i]);
+        }
+    }
+    blake2bp_root_final(&root, hashes, out, (uint8_t) outlen);
+    sodium_memzero(leaves, sizeof leaves);
+    sodium_memzero(hashes, sizeof hashes);
+
+    return 0;
+}
+
+int
+crypto_generichash_blake2bp(unsigned char *out, size_t outlen,
+                            const unsigned char *in, unsigned long long inlen,
+                            const unsigned char *key, size_t keylen)
+{
+    return crypto_generichash_blake2bp_threaded(out, outlen, in, inlen,
+                                                key, keylen, 1U);
+}
+
+int
+crypto_generichash_blake2bp_init(crypto_generichash_blake2bp_state *state,
+                                 const unsigned char *key,
+                                 const size_t keylen, const size_t outlen)
+{
+    BLAKE2bpState *st = blake2bp_state(state);
+
+    if (outlen <= 0U || outlen > BLAKE2B_OUTBYTES ||
+        keylen > BLAKE2B_KEYBYTES) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+    if (key == NULL) {
+        blake2bp_init(st->leaves, &st->root, (uint8_t) outlen, NULL, 0U);
+    } else {
+        blake2bp_init(st->leaves, &st->root, (uint8_t) outlen,
+                      key, (uint8_t) keylen);
+    }
+    st->buflen = 0U;
+    st->outlen = outlen;
+
+    return 0;
+}
+
+int
+crypto_generichash_blake2bp_update(crypto_generichash_blake2bp_state *state,
+                                   const unsigned char *in,
+                                   unsigned long long inlen)
+{
+    BLAKE2bpState *st = blake2bp_state(state);
+    size_t         left = st->buflen;
+    size_t         fill = sizeof st->buf - left;
+    uint64_t       tail;
+
+    if (left > 0U && inlen >= fill) {
+        memcpy(st->buf + left, in, fill);
+        blake2bp_leaves_update(st->leaves, st->buf, sizeof st->buf,
+                               0U, BLAKE2BP_LEAVES);
+        in += fill;
+        inlen -= fill;
+        left = 0U;
+    }
+    blake2bp_leaves_update(st->leaves, in, (uint64_t) inlen,
+                           0U, BLAKE2BP_LEAVES);
+    tail = (uint64_t) inlen % BLAKE2BP_STRIPE;
+    if (tail > 0U) {
+        memcpy(st->buf + left, in + (inlen - tail), (size_t) tail);
+    }
+    st->buflen = left + (size_t) tail;
+
+    return 0;
+}
+
+int
+crypto_generichash_blake2bp_final(crypto_generichash_blake2bp_state *state,
+                                  unsigned char *out,
+                                  const size_t outlen)
+{
+    BLAKE2bpState *st = blake2bp_state(state);
+    uint8_t        hashes[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES];
+
+    if (outlen <= 0U || outlen != st->outlen) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    blake2bp_leaves_final(st->leaves, hashes, st->buf, st->buflen,
+                          0U, BLAKE2BP_LEAVES);
+    blake2bp_root_final(&st->root, hashes, out, (uint8_t) outlen);
+    sodium_memzero(hashes, sizeof hashes);
+    st->outlen = 0U;
+
+    return 0;
+}
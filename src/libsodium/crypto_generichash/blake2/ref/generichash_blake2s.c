@@ -0,0 +1,114 @@
+
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include "crypto_generichash_blake2s.h"
+#include "blake2.h"
+
+int
+crypto_generichash_blake2s(unsigned char *out, size_t outlen,
+                           const unsigned char *in, unsigned long long inlen,
+                           const unsigned char *key, size_t keylen)
+{
+    if (outlen <= 0U || outlen > BLAKE2S_OUTBYTES ||
+        keylen > BLAKE2S_KEYBYTES || inlen > UINT64_MAX) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+
+    return blake2s((uint8_t *) out, in, key,
+                   (uint8_t) outlen, (uint64_t) inlen, (uint8_t) keylen);
+}
+
+int
+crypto_generichash_blake2s_salt_personal(unsigned char *out, size_t outlen,
+                                         const unsigned char *in, unsigned long long inlen,
+                                         const unsigned char *key, size_t keylen,
+                                         const unsigned char *salt,
+                                         const unsigned char *personal)
+{
+    if (outlen <= 0U || outlen > BLAKE2S_OUTBYTES ||
+        keylen > BLAKE2S_KEYBYTES || inlen > UINT64_MAX) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+
+    return blake2s_salt_personal((uint8_t *) out, in, key,
+                                 (uint8_t) outlen, (uint64_t) inlen, (uint8_t) keylen,
+                                 salt, personal);
+}
+
+int
+crypto_generichash_blake2s_init(crypto_generichash_blake2s_state *state,
+                                const unsigned char *key,
+                                const size_t keylen, const size_t outlen)
+{
+    if (outlen <= 0U || outlen > BLAKE2S_OUTBYTES ||
+        keylen > BLAKE2S_KEYBYTES) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+    if (key == NULL || keylen <= 0U) {
+        if (blake2s_init(state, (uint8_t) outlen) != 0) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+    } else if (blake2s_init_key(state, (uint8_t) outlen, key,
+                                (uint8_t) keylen) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    return 0;
+}
+
+int
+crypto_generichash_blake2s_init_salt_personal(crypto_generichash_blake2s_state *state,
+                                              const unsigned char *key,
+                                              const size_t keylen, const size_t outlen,
+                                              const unsigned char *salt,
+                                              const unsigned char *personal)
+{
+    if (outlen <= 0U || outlen > BLAKE2S_OUTBYTES ||
+        keylen > BLAKE2S_KEYBYTES) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    assert(keylen <= UINT8_MAX);
+    if (key == NULL || keylen <= 0U) {
+        if (blake2s_init_salt_personal(state, (uint8_t) outlen,
+                                       salt, personal) != 0) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+    } else if (blake2s_init_key_salt_personal(state,
+                                              (uint8_t) outlen, key,
+                                              (uint8_t) keylen,
+                                              salt, personal) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    return 0;
+}
+
+int
+crypto_generichash_blake2s_update(crypto_generichash_blake2s_state *state,
+                                  const unsigned char *in,
+                                  unsigned long long inlen)
+{
+    return blake2s_update(state, (const uint8_t *) in, (uint64_t) inlen);
+}
+
+int
+crypto_generichash_blake2s_final(crypto_generichash_blake2s_state *state,
+                                 unsigned char *out,
+                                 const size_t outlen)
+{
+    assert(outlen <= UINT8_MAX);
+    return blake2s_final(state, (uint8_t *) out, (uint8_t) outlen);
+}
+
+int
+_crypto_generichash_blake2s_pick_best_implementation(void)
+{
+    return blake2s_pick_best_implementation();
+}
@@ -0,0 +1,207 @@
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+#endif
+
+#include "crypto_generichash.h"
+#include "crypto_generichash_blake2bp.h"
+#include "utils.h"
+
+#ifndef O_BINARY
+# define O_BINARY 0
+#endif
+
+#define GENERICHASH_FILE_BUFBYTES (1024U * 1024U)
+
+typedef struct GenerichashFileState_ {
+    crypto_generichash_blake2b_state  blake2b;
+    crypto_generichash_blake2bp_state blake2bp;
+    size_t                            threads;
+    int                               tree;
+} GenerichashFileState;
+
+/*
+ * Regular files are mapped and hashed in a single pass, starting from the
+ * current file offset. The offset is then moved to the end of the file, as
+ * if the content had been read.
+ */
+#if defined(HAVE_MMAP) && !defined(__EMSCRIPTEN__)
+static int
+_generichash_fd_mmap(unsigned char *out, size_t outlen, int fd,
+                     const unsigned char *key, size_t keylen,
+                     const GenerichashFileState *st)
+{
+    struct stat    sb;
+    unsigned char *map;
+    off_t          offset;
+    off_t          map_offset;
+    size_t         map_len;
+    long           page_size;
+    int            ret;
+
+    if (fstat(fd, &sb) != 0 || !S_ISREG(sb.st_mode) ||
+        (offset = lseek(fd, 0, SEEK_CUR)) < (off_t) 0 ||
+        offset >= sb.st_size || (page_size = sysconf(_SC_PAGESIZE)) <= 0L) {
+        return -1;
+    }
+    map_offset = offset - offset % (off_t) page_size;
+    if ((uintmax_t) (sb.st_size - map_offset) > (uintmax_t) SIZE_MAX) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    map_len = (size_t) (sb.st_size - map_offset);
+    map = (unsigned char *) mmap(NULL, map_len, PROT_READ, MAP_SHARED,
+                                 fd, map_offset);
+    if (map == (unsigned char *) MAP_FAILED) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+# if defined(MADV_SEQUENTIAL) && defined(HAVE_MADVISE)
+    (void) madvise(map, map_len, MADV_SEQUENTIAL);
+# endif
+    if (st->tree) {
+        ret = crypto_generichash_blake2bp_threaded
+            (out, outlen, map + (offset - map_offset),
+             (unsigned long long) (sb.st_size - offset), key, keylen, st->threads);
+    } else {
+        ret = crypto_generichash_blake2b
+            (out, outlen, map + (offset - map_offset),
+             (unsigned long long) (sb.st_size - offset), key, keylen);
+    }
+    (void) munmap(map, map_len);
+    if (ret == 0 && lseek(fd, sb.st_size, SEEK_SET) < (off_t) 0) {
+        ret = -1; /* LCOV_EXCL_LINE */
+    }
+    return ret;
+}
+#endif
+
+static int
+_generichash_fd_read(unsigned char *out, size_t outlen, int fd,
+                     const unsigned char *key, size_t keylen,
+                     GenerichashFileState *st)
+{
+    unsigned char *buf;
+    long           readnb;
+    int            ret = -1;
+
+    if ((buf = (unsigned char *) malloc(GENERICHASH_FILE_BUFBYTES)) == NULL) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    if (st->tree) {
+        if (crypto_generichash_blake2bp_init(&st->blake2bp, key, keylen,
+                                             outlen) != 0) {
+            goto bail;
+        }
+    } else if (crypto_generichash_blake2b_init(&st->blake2b, key, keylen,
+                                               outlen) != 0) {
+        goto bail;
+    }
+    for (;;) {
+        while ((readnb = (long) read(fd, buf, GENERICHASH_FILE_BUFBYTES)) < 0L &&
+               (errno == EINTR || errno == EAGAIN)); /* LCOV_EXCL_LINE */
+        if (readnb < 0L) {
+            goto bail;
+        }
+        if (readnb == 0L) {
+            break;
+        }
+        if (st->tree) {
+            crypto_generichash_blake2bp_update(&st->blake2bp, buf,
+                                               (unsigned long long) readnb);
+        } else {
+            crypto_generichash_blake2b_update(&st->blake2b, buf,
+                                              (unsigned long long) readnb);
+        }
+    }
+    if (st->tree) {
+        ret = crypto_generichash_blake2bp_final(&st->blake2bp, out, outlen);
+    } else {
+        ret = crypto_generichash_blake2b_final(&st->blake2b, out, outlen);
+    }
+bail:
+    free(buf);
+    sodium_memzero(st, sizeof *st);
+
+    return ret;
+}
+
+static int
+_generichash_fd(unsigned char *out, size_t outlen, int fd,
+                const unsigned char *key, size_t keylen,
+                int tree, size_t threads)
+{
+    GenerichashFileState st;
+
+    if (outlen <= 0U || outlen > crypto_generichash_blake2b_BYTES_MAX ||
+        keylen > crypto_generichash_blake2b_KEYBYTES_MAX) {
+        return -1;
+    }
+    st.tree = tree;
+    st.threads = threads;
+#if defined(HAVE_MMAP) && !defined(__EMSCRIPTEN__)
+    if (_generichash_fd_mmap(out, outlen, fd, key, keylen, &st) == 0) {
+        return 0;
+    }
+#endif
+    return _generichash_fd_read(out, outlen, fd, key, keylen, &st);
+}
+
+static int
+_generichash_file(unsigned char *out, size_t outlen, const char *path,
+                  const unsigned char *key, size_t keylen,
+                  int tree, size_t threads)
+{
+    int fd;
+    int ret;
+
+    if ((fd = open(path, O_RDONLY | O_BINARY)) == -1) {
+        return -1;
+    }
+    ret = _generichash_fd(out, outlen, fd, key, keylen, tree, threads);
+    (void) close(fd);
+
+    return ret;
+}
+
+int
+crypto_generichash_fd(unsigned char *out, size_t outlen, int fd,
+                      const unsigned char *key, size_t keylen)
+{
+    return _generichash_fd(out, outlen, fd, key, keylen, 0, 1U);
+}
+
+int
+crypto_generichash_file(unsigned char *out, size_t outlen, const char *path,
+                        const unsigned char *key, size_t keylen)
+{
+    return _generichash_file(out, outlen, path, key, keylen, 0, 1U);
+}
+
+int
+crypto_generichash_blake2bp_fd(unsigned char *out, size_t outlen, int fd,
+                               const unsigned char *key, size_t keylen,
+                               size_t threads)
+{
+    return _generichash_fd(out, outlen, fd, key, keylen, 1, threads);
+}
+
+int
+crypto_generichash_blake2bp_file(unsigned char *out, size_t outlen,
+                                 const char *path,
+                                 const unsigned char *key, size_t keylen,
+                                 size_t threads)
+{
+    return _generichash_file(out, outlen, path, key, keylen, 1, threads);
+}
@@ -0,0 +1,144 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hash_sha256_avx2.h"
+
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+#pragma GCC target("sse4.1")
+#pragma GCC target("avx2")
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ADD(x, y)    _mm256_add_epi32((x), (y))
+#define XOR(x, y)    _mm256_xor_si256((x), (y))
+#define ROTR(x, n)   _mm256_or_si256(_mm256_srli_epi32((x), (n)), \
+                                     _mm256_slli_epi32((x), 32 - (n)))
+#define SHR(x, n)    _mm256_srli_epi32((x), (n))
+
+#define Ch(x, y, z)  XOR(_mm256_and_si256((x), XOR((y), (z))), (z))
+#define Maj(x, y, z) _mm256_or_si256(_mm256_and_si256((x), _mm256_or_si256((y), (z))), \
+                                     _mm256_and_si256((y), (z)))
+#define S0(x)        XOR(XOR(ROTR((x), 2), ROTR((x), 13)), ROTR((x), 22))
+#define S1(x)        XOR(XOR(ROTR((x), 6), ROTR((x), 11)), ROTR((x), 25))
+#define s0(x)        XOR(XOR(ROTR((x), 7), ROTR((x), 18)), SHR((x), 3))
+#define s1(x)        XOR(XOR(ROTR((x), 17), ROTR((x), 19)), SHR((x), 10))
+
+#define RND(a, b, c, d, e, f, g, h, i, sched)                           \
+    do {                                                                \
+        if (sched) {                                                    \
+            W[(i) & 15] = ADD(ADD(s1(W[((i) - 2) & 15]), W[((i) - 7) & 15]), \
+                              ADD(s0(W[((i) - 15) & 15]), W[(i) & 15]));   \
+        }                                                               \
+        t0 = ADD(ADD(h, S1(e)), ADD(Ch(e, f, g),                        \
+                 ADD(_mm256_set1_epi32((int) K256[i]), W[(i) & 15])));  \
+        t1 = ADD(S0(a), Maj(a, b, c));                                  \
+        d = ADD(d, t0);                                                 \
+        h = ADD(t0, t1);                                                \
+    } while (0)
+
+#define RNDS8(i, sched)                                                 \
+    do {                                                                \
+        RND(a, b, c, d, e, f, g, h, (i) + 0, sched);                    \
+        RND(h, a, b, c, d, e, f, g, (i) + 1, sched);                    \
+        RND(g, h, a, b, c, d, e, f, (i) + 2, sched);                    \
+        RND(f, g, h, a, b, c, d, e, (i) + 3, sched);                    \
+        RND(e, f, g, h, a, b, c, d, (i) + 4, sched);                    \
+        RND(d, e, f, g, h, a, b, c, (i) + 5, sched);                    \
+        RND(c, d, e, f, g, h, a, b, (i) + 6, sched);                    \
+        RND(b, c, d, e, f, g, h, a, (i) + 7, sched);                    \
+    } while (0)
+
+/* W[o..o+7] <- word o..o+7 of the eight blocks, one lane per block */
+static void
+load_transposed(__m256i W[16], const unsigned char * const blocks[8], size_t o)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bLL,
+                                            0x0405060700010203LL,
+                                            0x0c0d0e0f08090a0bLL,
+                                            0x0405060700010203LL);
+    __m256i r[8], t[8], u[8];
+    int     i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm256_shuffle_epi8
+            (_mm256_loadu_si256((const __m256i *) (blocks[i] + o * 4)), bswap);
+    }
+    for (i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    for (i = 0; i < 8; i += 4) {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (i = 0; i < 4; i++) {
+        W[o + i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+        W[o + i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+}
+
+/*
+ * One block for each of eight independent messages. The state is
+ * transposed: state[w * 8 + l] is word w of lane l.
+ */
+void
+crypto_hash_sha256_avx2_blocks8(uint32_t state[64],
+                                const unsigned char * const blocks[8])
+{
+    __m256i W[16];
+    __m256i S[8];
+    __m256i a, b, c, d, e, f, g, h;
+    __m256i t0, t1;
+    int     i;
+
+    load_transposed(W, blocks, 0);
+    load_transposed(W, blocks, 8);
+    for (i = 0; i < 8; i++) {
+        S[i] = _mm256_loadu_si256((const __m256i *) &state[i * 8]);
+    }
+    a = S[0]; b = S[1]; c = S[2]; d = S[3];
+    e = S[4]; f = S[5]; g = S[6]; h = S[7];
+    for (i = 0; i < 16; i += 8) {
+        RNDS8(i, 0);
+    }
+    for (i = 16; i < 64; i += 8) {
+        RNDS8(i, 1);
+    }
+    _mm256_storeu_si256((__m256i *) &state[0], ADD(S[0], a));
+    _mm256_storeu_si256((__m256i *) &state[8], ADD(S[1], b));
+    _mm256_storeu_si256((__m256i *) &state[16], ADD(S[2], c));
+    _mm256_storeu_si256((__m256i *) &state[24], ADD(S[3], d));
+    _mm256_storeu_si256((__m256i *) &state[32], ADD(S[4], e));
+    _mm256_storeu_si256((__m256i *) &state[40], ADD(S[5], f));
+    _mm256_storeu_si256((__m256i *) &state[48], ADD(S[6], g));
+    _mm256_storeu_si256((__m256i *) &state[56], ADD(S[7], h));
+}
+
+#endif
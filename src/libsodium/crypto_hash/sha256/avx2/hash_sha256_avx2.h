@@ -0,0 +1,6 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+void crypto_hash_sha256_avx2_blocks8(uint32_t state[64],
+                                     const unsigned char * const blocks[8]);
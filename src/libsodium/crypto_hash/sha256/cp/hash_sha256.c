@@ -27,8 +27,11 @@
  */
 
 #include "crypto_hash_sha256.h"
+#include "runtime.h"
 #include "utils.h"
 #include "private/common.h"
+#include "../avx2/hash_sha256_avx2.h"
+#include "../shani/hash_sha256_shani.h"
 
 #include <sys/types.h>
 
@@ -169,6 +172,23 @@ SHA256_Transform(uint32_t *state, const unsigned char block[64])
     sodium_memzero((void *) &t1, sizeof t1);
 }
 
+static void
+SHA256_Blocks(uint32_t state[8], const unsigned char *in, size_t blocks)
+{
+    while (blocks-- > 0U) {
+        SHA256_Transform(state, in);
+        in += 64;
+    }
+}
+
+static void (*sha256_blocks)(uint32_t state[8], const unsigned char *in,
+                             size_t blocks) = SHA256_Blocks;
+
+static void (*sha256_blocks8)(uint32_t state[64],
+                              const unsigned char * const blocks[8]) = NULL;
+
+static unsigned long long sha256_lanes_maxlen = ULLONG_MAX;
+
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -228,14 +248,13 @@ crypto_hash_sha256_update(crypto_hash_sha256_state *state,
     for (i = 0; i < 64 - r; i++) {
         state->buf[r + i] = in[i];
     }
-    SHA256_Transform(state->state, state->buf);
+    sha256_blocks(state->state, state->buf, 1U);
     in += 64 - r;
     inlen -= 64 - r;
 
-    while (inlen >= 64) {
-        SHA256_Transform(state->state, in);
-        in += 64;
-        inlen -= 64;
+    if (inlen >= 64) {
+        sha256_blocks(state->state, in, (size_t) (inlen / 64));
+        in += inlen & ~(unsigned long long) 63;
     }
     inlen &= 63;
     for (i = 0; i < inlen; i++) {
@@ -267,3 +286,180 @@ crypto_hash_sha256(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+/*
+ * Multi-buffer hashing: each of the eight lanes of sha256_blocks8() hashes
+ * a different message. A lane that reaches the end of its message,
+ * padding included, is retired and immediately refilled with the next one.
+ * Messages longer than sha256_lanes_maxlen are hashed one at a time instead.
+ */
+
+#define SHA256_LANES 8U
+
+typedef struct SHA256Lane_ {
+    const unsigned char *in;
+    unsigned long long   blocks;
+    unsigned char        pad[128];
+    size_t               pad_off;
+    size_t               pad_end;
+    size_t               msg;
+    int                  active;
+} SHA256Lane;
+
+static void
+SHA256_Lane_load(SHA256Lane *lane, uint32_t lanes_state[64], size_t l,
+                 const crypto_hash_sha256_state *state, size_t msg,
+                 const unsigned char *in, unsigned long long inlen)
+{
+    size_t r = (size_t) (inlen & 63);
+    size_t w;
+
+    lane->in = in;
+    lane->blocks = inlen / 64;
+    memset(lane->pad, 0, sizeof lane->pad);
+    memcpy(lane->pad, in + (inlen - r), r);
+    lane->pad[r] = 0x80;
+    lane->pad_off = 0U;
+    lane->pad_end = (r < 56) ? 64U : 128U;
+    STORE64_BE(&lane->pad[lane->pad_end - 8], state->count + (inlen << 3));
+    lane->msg = msg;
+    lane->active = 1;
+    for (w = 0; w < 8; w++) {
+        lanes_state[w * SHA256_LANES + l] = state->state[w];
+    }
+}
+
+static void
+SHA256_Serial(unsigned char *out, const crypto_hash_sha256_state *state,
+              const unsigned char *in, unsigned long long inlen)
+{
+    crypto_hash_sha256_state st;
+
+    memcpy(&st, state, sizeof st);
+    crypto_hash_sha256_update(&st, in, inlen);
+    crypto_hash_sha256_final(&st, out);
+}
+
+int
+_crypto_hash_sha256_multi_from_state(unsigned char *out,
+                                     const unsigned char * const *in,
+                                     const unsigned long long *inlen,
+                                     size_t n,
+                                     const crypto_hash_sha256_state *state)
+{
+    static const unsigned char idle[64];
+    SHA256Lane                 lanes[SHA256_LANES];
+    uint32_t                   lanes_state[8 * SHA256_LANES];
+    const unsigned char       *blocks[SHA256_LANES];
+    SHA256Lane                *lane;
+    size_t                     active = 0U;
+    size_t                     next = 0U;
+    size_t                     l;
+    size_t                     w;
+
+    if (sha256_blocks8 == NULL) {
+        for (next = 0U; next < n; next++) {
+            SHA256_Serial(&out[next * crypto_hash_sha256_BYTES], state,
+                          in[next], inlen[next]);
+        }
+        return 0;
+    }
+    for (l = 0U; l < SHA256_LANES; l++) {
+        lanes[l].active = 0;
+    }
+    for (;;) {
+        for (l = 0U; l < SHA256_LANES && next < n; l++) {
+            if (lanes[l].active == 0) {
+                while (next < n && inlen[next] > sha256_lanes_maxlen) {
+                    SHA256_Serial(&out[next * crypto_hash_sha256_BYTES], state,
+                                  in[next], inlen[next]);
+                    next++;
+                }
+                if (next >= n) {
+                    break;
+                }
+                SHA256_Lane_load(&lanes[l], lanes_state, l, state,
+                                 next, in[next], inlen[next]);
+                next++;
+                active++;
+            }
+        }
+        if (active == 0U) {
+            break;
+        }
+        for (l = 0U; l < SHA256_LANES; l++) {
+            lane = &lanes[l];
+            if (lane->active == 0) {
+                blocks[l] = idle;
+            } else if (lane->blocks > 0U) {
+                blocks[l] = lane->in;
+            } else {
+                blocks[l] = &lane->pad[lane->pad_off];
+            }
+        }
+        sha256_blocks8(lanes_state, blocks);
+        for (l = 0U; l < SHA256_LANES; l++) {
+            lane = &lanes[l];
+            if (lane->active == 0) {
+                continue;
+            }
+            if (lane->blocks > 0U) {
+                lane->in += 64;
+                lane->blocks--;
+                continue;
+            }
+            lane->pad_off += 64;
+            if (lane->pad_off < lane->pad_end) {
+                continue;
+            }
+            for (w = 0; w < 8; w++) {
+                STORE32_BE(&out[lane->msg * crypto_hash_sha256_BYTES + w * 4],
+                           lanes_state[w * SHA256_LANES + l]);
+            }
+            lane->active = 0;
+            active--;
+        }
+    }
+    sodium_memzero(lanes, sizeof lanes);
+    sodium_memzero(lanes_state, sizeof lanes_state);
+
+    return 0;
+}
+
+int
+crypto_hash_sha256_multi(unsigned char *out,
+                         const unsigned char * const *in,
+                         const unsigned long long *inlen, size_t n)
+{
+    crypto_hash_sha256_state state;
+
+    crypto_hash_sha256_init(&state);
+
+    return _crypto_hash_sha256_multi_from_state(out, in, inlen, n, &state);
+}
+
+int
+_crypto_hash_sha256_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+    sha256_blocks = SHA256_Blocks;
+    sha256_blocks8 = NULL;
+    sha256_lanes_maxlen = ULLONG_MAX;
+#if defined(HAVE_SHAINTRIN_H) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1900 && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)))
+    if (sodium_runtime_has_shani()) {
+        sha256_blocks = crypto_hash_sha256_shani_blocks;
+        /* SHA-NI is faster than the AVX2 lanes for all but short messages */
+        sha256_lanes_maxlen = 128U;
+    }
+#endif
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+    if (sodium_runtime_has_avx2()) {
+        sha256_blocks8 = crypto_hash_sha256_avx2_blocks8;
+    }
+#endif
+
+    return 0;
+/* LCOV_EXCL_STOP */
+}
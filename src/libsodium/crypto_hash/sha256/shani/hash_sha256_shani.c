@@ -0,0 +1,105 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hash_sha256_shani.h"
+
+#if defined(HAVE_SHAINTRIN_H) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1900 && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)))
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+#pragma GCC target("sse4.1")
+#pragma GCC target("sha")
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <smmintrin.h>
+#include <immintrin.h>
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* four rounds, using the message words in W */
+#define RNDS4(W, i)                                                         \
+    do {                                                                    \
+        msg = _mm_add_epi32((W),                                            \
+                            _mm_loadu_si128((const __m128i *) &K256[i]));   \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                \
+        msg = _mm_shuffle_epi32(msg, 0x0e);                                 \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);                \
+    } while (0)
+
+/* W0 <- the next four message words, given the previous sixteen in W0..W3 */
+#define SCHED(W0, W1, W2, W3)                                               \
+    (W0) = _mm_sha256msg2_epu32(                                            \
+        _mm_add_epi32(_mm_sha256msg1_epu32((W0), (W1)),                     \
+                      _mm_alignr_epi8((W3), (W2), 4)), (W3))
+
+void
+crypto_hash_sha256_shani_blocks(uint32_t state[8],
+                                const unsigned char *in, size_t blocks)
+{
+    const __m128i bswap =
+        _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i       state0, state1, abef, cdgh;
+    __m128i       msg, w0, w1, w2, w3;
+    __m128i       tmp;
+    int           i;
+
+    /* the rnds2 instruction wants the state as ABEF / CDGH */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[0]), 0xb1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[4]), 0x1b);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    while (blocks-- > 0U) {
+        abef = state0;
+        cdgh = state1;
+
+        w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in +  0)), bswap);
+        w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 16)), bswap);
+        w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 32)), bswap);
+        w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 48)), bswap);
+        RNDS4(w0, 0);
+        RNDS4(w1, 4);
+        RNDS4(w2, 8);
+        RNDS4(w3, 12);
+        for (i = 16; i < 64; i += 16) {
+            SCHED(w0, w1, w2, w3);
+            RNDS4(w0, i);
+            SCHED(w1, w2, w3, w0);
+            RNDS4(w1, i + 4);
+            SCHED(w2, w3, w0, w1);
+            RNDS4(w2, i + 8);
+            SCHED(w3, w0, w1, w2);
+            RNDS4(w3, i + 12);
+        }
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        in += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128((__m128i *) &state[0], _mm_blend_epi16(tmp, state1, 0xf0));
+    _mm_storeu_si128((__m128i *) &state[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+
+#endif
@@ -0,0 +1,6 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+void crypto_hash_sha256_shani_blocks(uint32_t state[8],
+                                     const unsigned char *in, size_t blocks);
@@ -0,0 +1,235 @@
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils.h"
+#include "hash_sha512_avx2.h"
+
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+#pragma GCC target("sse4.1")
+#pragma GCC target("avx2")
+#pragma GCC target("bmi2")
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+static const uint64_t K512[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define VROTR(x, n) _mm256_or_si256(_mm256_srli_epi64((x), (n)), \
+                                    _mm256_slli_epi64((x), 64 - (n)))
+#define Vs0(x)      _mm256_xor_si256(_mm256_xor_si256(VROTR((x), 1), VROTR((x), 8)), \
+                                     _mm256_srli_epi64((x), 7))
+#define Vs1(x)      _mm256_xor_si256(_mm256_xor_si256(VROTR((x), 19), VROTR((x), 61)), \
+                                     _mm256_srli_epi64((x), 6))
+
+/* (lo[1], lo[2], lo[3], hi[0]) */
+#define ALIGNR64(hi, lo) \
+    _mm256_alignr_epi8(_mm256_permute2x128_si256((lo), (hi), 0x21), (lo), 8)
+
+/* X0 <- W[t..t+3], given W[t-16..t-1] in X0..X3 */
+#define SCHED(X0, X1, X2, X3)                                              \
+    do {                                                                   \
+        __m256i t_ = _mm256_add_epi64(_mm256_add_epi64((X0), Vs0(ALIGNR64((X1), (X0)))), \
+                                      ALIGNR64((X3), (X2)));               \
+        t_ = _mm256_add_epi64(t_, Vs1(_mm256_permute2x128_si256((X3), (X3), 0x81))); \
+        (X0) = _mm256_add_epi64(t_, Vs1(_mm256_permute2x128_si256(t_, t_, 0x08)));   \
+    } while (0)
+
+#define ROTR(x, n)      ((x >> n) | (x << (64 - n)))
+#define Ch(x, y, z)     ((x & (y ^ z)) ^ z)
+#define Maj(x, y, z)    ((x & (y | z)) | (y & z))
+#define S0(x)           (ROTR(x, 28) ^ ROTR(x, 34) ^ ROTR(x, 39))
+#define S1(x)           (ROTR(x, 14) ^ ROTR(x, 18) ^ ROTR(x, 41))
+
+#define RND(a, b, c, d, e, f, g, h, i)              \
+    t0 = h + S1(e) + Ch(e, f, g) + WK[i];           \
+    t1 = S0(a) + Maj(a, b, c);                      \
+    d += t0;                                        \
+    h  = t0 + t1;
+
+#define RNDS8(i)                                    \
+    RND(a, b, c, d, e, f, g, h, (i) + 0);           \
+    RND(h, a, b, c, d, e, f, g, (i) + 1);           \
+    RND(g, h, a, b, c, d, e, f, (i) + 2);           \
+    RND(f, g, h, a, b, c, d, e, (i) + 3);           \
+    RND(e, f, g, h, a, b, c, d, (i) + 4);           \
+    RND(d, e, f, g, h, a, b, c, (i) + 5);           \
+    RND(c, d, e, f, g, h, a, b, (i) + 6);           \
+    RND(b, c, d, e, f, g, h, a, (i) + 7);
+
+/*
+ * The message schedule is computed four words at a time with AVX2, and
+ * stored with the round constants added. The rounds themselves are
+ * scalar; BMI2 lets the compiler use rorx for the rotations.
+ */
+void
+crypto_hash_sha512_avx2_blocks(uint64_t state[8],
+                               const unsigned char *in, size_t blocks)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fLL,
+                                            0x0001020304050607LL,
+                                            0x08090a0b0c0d0e0fLL,
+                                            0x0001020304050607LL);
+    uint64_t      WK[80];
+    uint64_t      a, b, c, d, e, f, g, h;
+    uint64_t      t0, t1;
+    __m256i       X0, X1, X2, X3;
+    int           i;
+
+    a = state[0]; b = state[1]; c = state[2]; d = state[3];
+    e = state[4]; f = state[5]; g = state[6]; h = state[7];
+    while (blocks-- > 0U) {
+        X0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) (in + 0)), bswap);
+        X1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) (in + 32)), bswap);
+        X2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) (in + 64)), bswap);
+        X3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) (in + 96)), bswap);
+        for (i = 0; i < 80; i += 16) {
+            _mm256_storeu_si256((__m256i *) &WK[i + 0],
+                                _mm256_add_epi64(X0, _mm256_loadu_si256((const __m256i *) &K512[i + 0])));
+            _mm256_storeu_si256((__m256i *) &WK[i + 4],
+                                _mm256_add_epi64(X1, _mm256_loadu_si256((const __m256i *) &K512[i + 4])));
+            _mm256_storeu_si256((__m256i *) &WK[i + 8],
+                                _mm256_add_epi64(X2, _mm256_loadu_si256((const __m256i *) &K512[i + 8])));
+            _mm256_storeu_si256((__m256i *) &WK[i + 12],
+                                _mm256_add_epi64(X3, _mm256_loadu_si256((const __m256i *) &K512[i + 12])));
+            if (i < 64) {
+                SCHED(X0, X1, X2, X3);
+                SCHED(X1, X2, X3, X0);
+                SCHED(X2, X3, X0, X1);
+                SCHED(X3, X0, X1, X2);
+            }
+        }
+        for (i = 0; i < 80; i += 8) {
+            RNDS8(i);
+        }
+        a = (state[0] += a); b = (state[1] += b);
+        c = (state[2] += c); d = (state[3] += d);
+        e = (state[4] += e); f = (state[5] += f);
+        g = (state[6] += g); h = (state[7] += h);
+        in += 128;
+    }
+    sodium_memzero((void *) WK, sizeof WK);
+}
+
+#define VADD(x, y)   _mm256_add_epi64((x), (y))
+#define VXOR(x, y)   _mm256_xor_si256((x), (y))
+#define VCh(x, y, z) VXOR(_mm256_and_si256((x), VXOR((y), (z))), (z))
+#define VMaj(x, y, z) _mm256_or_si256(_mm256_and_si256((x), _mm256_or_si256((y), (z))), \
+                                      _mm256_and_si256((y), (z)))
+#define VS0(x)       VXOR(VXOR(VROTR((x), 28), VROTR((x), 34)), VROTR((x), 39))
+#define VS1(x)       VXOR(VXOR(VROTR((x), 14), VROTR((x), 18)), VROTR((x), 41))
+
+#define VRND(a, b, c, d, e, f, g, h, i, sched)                          \
+    do {                                                                \
+        if (sched) {                                                    \
+            W[(i) & 15] = VADD(VADD(Vs1(W[((i) - 2) & 15]), W[((i) - 7) & 15]), \
+                               VADD(Vs0(W[((i) - 15) & 15]), W[(i) & 15]));   \
+        }                                                               \
+        v0 = VADD(VADD(h, VS1(e)), VADD(VCh(e, f, g),                   \
+                  VADD(_mm256_set1_epi64x((long long) K512[i]), W[(i) & 15]))); \
+        v1 = VADD(VS0(a), VMaj(a, b, c));                               \
+        d = VADD(d, v0);                                                \
+        h = VADD(v0, v1);                                               \
+    } while (0)
+
+#define VRNDS8(i, sched)                                                \
+    do {                                                                \
+        VRND(a, b, c, d, e, f, g, h, (i) + 0, sched);                   \
+        VRND(h, a, b, c, d, e, f, g, (i) + 1, sched);                   \
+        VRND(g, h, a, b, c, d, e, f, (i) + 2, sched);                   \
+        VRND(f, g, h, a, b, c, d, e, (i) + 3, sched);                   \
+        VRND(e, f, g, h, a, b, c, d, (i) + 4, sched);                   \
+        VRND(d, e, f, g, h, a, b, c, (i) + 5, sched);                   \
+        VRND(c, d, e, f, g, h, a, b, (i) + 6, sched);                   \
+        VRND(b, c, d, e, f, g, h, a, (i) + 7, sched);                   \
+    } while (0)
+
+/*
+ * One block for each of four independent messages. The state is
+ * transposed: state[w * 4 + l] is word w of lane l.
+ */
+void
+crypto_hash_sha512_avx2_blocks4(uint64_t state[32],
+                                const unsigned char * const blocks[4])
+{
+    const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fLL,
+                                            0x0001020304050607LL,
+                                            0x08090a0b0c0d0e0fLL,
+                                            0x0001020304050607LL);
+    __m256i       W[16];
+    __m256i       S[8];
+    __m256i       r[4], t[4];
+    __m256i       a, b, c, d, e, f, g, h;
+    __m256i       v0, v1;
+    int           i;
+    int           o;
+
+    for (o = 0; o < 16; o += 4) {
+        for (i = 0; i < 4; i++) {
+            r[i] = _mm256_shuffle_epi8
+                (_mm256_loadu_si256((const __m256i *) (blocks[i] + o * 8)), bswap);
+        }
+        t[0] = _mm256_unpacklo_epi64(r[0], r[1]);
+        t[1] = _mm256_unpackhi_epi64(r[0], r[1]);
+        t[2] = _mm256_unpacklo_epi64(r[2], r[3]);
+        t[3] = _mm256_unpackhi_epi64(r[2], r[3]);
+        W[o + 0] = _mm256_permute2x128_si256(t[0], t[2], 0x20);
+        W[o + 1] = _mm256_permute2x128_si256(t[1], t[3], 0x20);
+        W[o + 2] = _mm256_permute2x128_si256(t[0], t[2], 0x31);
+        W[o + 3] = _mm256_permute2x128_si256(t[1], t[3], 0x31);
+    }
+    for (i = 0; i < 8; i++) {
+        S[i] = _mm256_loadu_si256((const __m256i *) &state[i * 4]);
+    }
+    a = S[0]; b = S[1]; c = S[2]; d = S[3];
+    e = S[4]; f = S[5]; g = S[6]; h = S[7];
+    for (i = 0; i < 16; i += 8) {
+        VRNDS8(i, 0);
+    }
+    for (i = 16; i < 80; i += 8) {
+        VRNDS8(i, 1);
+    }
+    _mm256_storeu_si256((__m256i *) &state[0], VADD(S[0], a));
+    _mm256_storeu_si256((__m256i *) &state[4], VADD(S[1], b));
+    _mm256_storeu_si256((__m256i *) &state[8], VADD(S[2], c));
+    _mm256_storeu_si256((__m256i *) &state[12], VADD(S[3], d));
+    _mm256_storeu_si256((__m256i *) &state[16], VADD(S[4], e));
+    _mm256_storeu_si256((__m256i *) &state[20], VADD(S[5], f));
+    _mm256_storeu_si256((__m256i *) &state[24], VADD(S[6], g));
+    _mm256_storeu_si256((__m256i *) &state[28], VADD(S[7], h));
+}
+
+#endif
@@ -0,0 +1,9 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+void crypto_hash_sha512_avx2_blocks(uint64_t state[8],
+                                    const unsigned char *in, size_t blocks);
+
+void crypto_hash_sha512_avx2_blocks4(uint64_t state[32],
+                                     const unsigned char * const blocks[4]);
@@ -27,8 +27,10 @@
  */
 
 #include "crypto_hash_sha512.h"
+#include "runtime.h"
 #include "utils.h"
 #include "private/common.h"
+#include "../avx2/hash_sha512_avx2.h"
 
 #include <sys/types.h>
 
@@ -185,6 +187,21 @@ SHA512_Transform(uint64_t *state, const unsigned char block[128])
     sodium_memzero((void *) &t1, sizeof t1);
 }
 
+static void
+SHA512_Blocks(uint64_t state[8], const unsigned char *in, size_t blocks)
+{
+    while (blocks-- > 0U) {
+        SHA512_Transform(state, in);
+        in += 128;
+    }
+}
+
+static void (*sha512_blocks)(uint64_t state[8], const unsigned char *in,
+                             size_t blocks) = SHA512_Blocks;
+
+static void (*sha512_blocks4)(uint64_t state[32],
+                              const unsigned char * const blocks[4]) = NULL;
+
 static unsigned char PAD[128] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -257,14 +274,13 @@ crypto_hash_sha512_update(crypto_hash_sha512_state *state,
     for (i = 0; i < 128 - r; i++) {
         state->buf[r + i] = in[i];
     }
-    SHA512_Transform(state->state, state->buf);
+    sha512_blocks(state->state, state->buf, 1U);
     in += 128 - r;
     inlen -= 128 - r;
 
-    while (inlen >= 128) {
-        SHA512_Transform(state->state, in);
-        in += 128;
-        inlen -= 128;
+    if (inlen >= 128) {
+        sha512_blocks(state->state, in, (size_t) (inlen / 128));
+        in += inlen & ~(unsigned long long) 127;
     }
     inlen &= 127;
     for (i = 0; i < inlen; i++) {
@@ -296,3 +312,159 @@ crypto_hash_sha512(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+/*
+ * Multi-buffer hashing: each of the four lanes of sha512_blocks4() hashes
+ * a different message. A lane that reaches the end of its message,
+ * padding included, is retired and immediately refilled with the next one.
+ */
+
+#define SHA512_LANES 4U
+
+typedef struct SHA512Lane_ {
+    const unsigned char *in;
+    unsigned long long   blocks;
+    unsigned char        pad[256];
+    size_t               pad_off;
+    size_t               pad_end;
+    size_t               msg;
+    int                  active;
+} SHA512Lane;
+
+static void
+SHA512_Lane_load(SHA512Lane *lane, uint64_t lanes_state[32], size_t l,
+                 const crypto_hash_sha512_state *state, size_t msg,
+                 const unsigned char *in, unsigned long long inlen)
+{
+    uint64_t bitlen[2];
+    size_t   r = (size_t) (inlen & 127);
+    size_t   w;
+
+    bitlen[1] = state->count[1] + ((uint64_t) inlen << 3);
+    bitlen[0] = state->count[0] + ((uint64_t) inlen >> 61) +
+        (bitlen[1] < state->count[1]);
+    lane->in = in;
+    lane->blocks = inlen / 128;
+    memset(lane->pad, 0, sizeof lane->pad);
+    memcpy(lane->pad, in + (inlen - r), r);
+    lane->pad[r] = 0x80;
+    lane->pad_off = 0U;
+    lane->pad_end = (r < 112) ? 128U : 256U;
+    be64enc_vect(&lane->pad[lane->pad_end - 16], bitlen, 16);
+    lane->msg = msg;
+    lane->active = 1;
+    for (w = 0; w < 8; w++) {
+        lanes_state[w * SHA512_LANES + l] = state->state[w];
+    }
+}
+
+int
+_crypto_hash_sha512_multi_from_state(unsigned char *out,
+                                     const unsigned char * const *in,
+                                     const unsigned long long *inlen,
+                                     size_t n,
+                                     const crypto_hash_sha512_state *state)
+{
+    static const unsigned char idle[128];
+    SHA512Lane                 lanes[SHA512_LANES];
+    uint64_t                   lanes_state[8 * SHA512_LANES];
+    const unsigned char       *blocks[SHA512_LANES];
+    crypto_hash_sha512_state   st;
+    SHA512Lane                *lane;
+    size_t                     active = 0U;
+    size_t                     next = 0U;
+    size_t                     l;
+    size_t                     w;
+
+    if (sha512_blocks4 == NULL) {
+        for (next = 0U; next < n; next++) {
+            memcpy(&st, state, sizeof st);
+            crypto_hash_sha512_update(&st, in[next], inlen[next]);
+            crypto_hash_sha512_final(&st, &out[next * crypto_hash_sha512_BYTES]);
+        }
+        return 0;
+    }
+    for (l = 0U; l < SHA512_LANES; l++) {
+        lanes[l].active = 0;
+    }
+    for (;;) {
+        for (l = 0U; l < SHA512_LANES && next < n; l++) {
+            if (lanes[l].active == 0) {
+                SHA512_Lane_load(&lanes[l], lanes_state, l, state,
+                                 next, in[next], inlen[next]);
+                next++;
+                active++;
+            }
+        }
+        if (active == 0U) {
+            break;
+        }
+        for (l = 0U; l < SHA512_LANES; l++) {
+            lane = &lanes[l];
+            if (lane->active == 0) {
+                blocks[l] = idle;
+            } else if (lane->blocks > 0U) {
+                blocks[l] = lane->in;
+            } else {
+                blocks[l] = &lane->pad[lane->pad_off];
+            }
+        }
+        sha512_blocks4(lanes_state, blocks);
+        for (l = 0U; l < SHA512_LANES; l++) {
+            lane = &lanes[l];
+            if (lane->active == 0) {
+                continue;
+            }
+            if (lane->blocks > 0U) {
+                lane->in += 128;
+                lane->blocks--;
+                continue;
+            }
+            lane->pad_off += 128;
+            if (lane->pad_off < lane->pad_end) {
+                continue;
+            }
+            for (w = 0; w < 8; w++) {
+                STORE64_BE(&out[lane->msg * crypto_hash_sha512_BYTES + w * 8],
+                           lanes_state[w * SHA512_LANES + l]);
+            }
+            lane->active = 0;
+            active--;
+        }
+    }
+    sodium_memzero(lanes, sizeof lanes);
+    sodium_memzero(lanes_state, sizeof lanes_state);
+
+    return 0;
+}
+
+int
+crypto_hash_sha512_multi(unsigned char *out,
+                         const unsigned char * const *in,
+                         const unsigned long long *inlen, size_t n)
+{
+    crypto_hash_sha512_state state;
+
+    crypto_hash_sha512_init(&state);
+
+    return _crypto_hash_sha512_multi_from_state(out, in, inlen, n, &state);
+}
+
+int
+_crypto_hash_sha512_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+    if (sodium_runtime_has_avx2() && sodium_runtime_has_bmi2()) {
+        sha512_blocks = crypto_hash_sha512_avx2_blocks;
+        sha512_blocks4 = crypto_hash_sha512_avx2_blocks4;
+        return 0;
+    }
+#endif
+    sha512_blocks = SHA512_Blocks;
+    sha512_blocks4 = NULL;
+
+    return 0;
+/* LCOV_EXCL_STOP */
+}
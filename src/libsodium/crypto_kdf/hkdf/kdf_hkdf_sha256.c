@@ -0,0 +1,138 @@
+#include <errno.h>
+#include <string.h>
+
+#include "crypto_auth_hmacsha256.h"
+#include "crypto_kdf_hkdf_sha256.h"
+#include "randombytes.h"
+#include "utils.h"
+
+size_t
+crypto_kdf_hkdf_sha256_keybytes(void)
+{
+    return crypto_kdf_hkdf_sha256_KEYBYTES;
+}
+
+size_t
+crypto_kdf_hkdf_sha256_bytes_min(void)
+{
+    return crypto_kdf_hkdf_sha256_BYTES_MIN;
+}
+
+size_t
+crypto_kdf_hkdf_sha256_bytes_max(void)
+{
+    return crypto_kdf_hkdf_sha256_BYTES_MAX;
+}
+
+size_t
+crypto_kdf_hkdf_sha256_prk_statebytes(void)
+{
+    return sizeof(crypto_kdf_hkdf_sha256_prk_state);
+}
+
+int
+crypto_kdf_hkdf_sha256_extract(unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES],
+                               const unsigned char *salt, size_t salt_len,
+                               const unsigned char *ikm, size_t ikm_len)
+{
+    crypto_auth_hmacsha256_state st;
+
+    crypto_auth_hmacsha256_init(&st, salt, salt_len);
+    crypto_auth_hmacsha256_update(&st, ikm, (unsigned long long) ikm_len);
+    crypto_auth_hmacsha256_final(&st, prk);
+    sodium_memzero(&st, sizeof st);
+
+    return 0;
+}
+
+void
+crypto_kdf_hkdf_sha256_keygen(unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES])
+{
+    randombytes_buf(prk, crypto_kdf_hkdf_sha256_KEYBYTES);
+}
+
+int
+crypto_kdf_hkdf_sha256_prk_init(crypto_kdf_hkdf_sha256_prk_state *state,
+                                const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES])
+{
+    return crypto_auth_hmacsha256_keyed_init(state, prk,
+                                             crypto_kdf_hkdf_sha256_KEYBYTES);
+}
+
+int
+crypto_kdf_hkdf_sha256_expand_from_state(unsigned char *out, size_t out_len,
+                                         const char *ctx, size_t ctx_len,
+                                         const crypto_kdf_hkdf_sha256_prk_state *state)
+{
+    crypto_auth_hmacsha256_state st;
+    unsigned char                tmp[crypto_auth_hmacsha256_BYTES];
+    size_t                       i;
+    unsigned char                counter = 1U;
+
+    if (out_len > crypto_kdf_hkdf_sha256_BYTES_MAX) {
+        errno = EINVAL;
+        return -1;
+    }
+    for (i = (size_t) 0U; i < out_len; i += crypto_auth_hmacsha256_BYTES) {
+        crypto_auth_hmacsha256_keyed_start(&st, state);
+        if (i != (size_t) 0U) {
+            crypto_auth_hmacsha256_update(&st,
+                                          &out[i - crypto_auth_hmacsha256_BYTES],
+                                          crypto_auth_hmacsha256_BYTES);
+        }
+        crypto_auth_hmacsha256_update(&st, (const unsigned char *) ctx,
+                                      (unsigned long long) ctx_len);
+        crypto_auth_hmacsha256_update(&st, &counter, 1U);
+        if (out_len - i >= crypto_auth_hmacsha256_BYTES) {
+            crypto_auth_hmacsha256_final(&st, &out[i]);
+        } else {
+            crypto_auth_hmacsha256_final(&st, tmp);
+            memcpy(&out[i], tmp, out_len - i);
+            sodium_memzero(tmp, sizeof tmp);
+        }
+        counter++;
+    }
+    sodium_memzero(&st, sizeof st);
+
+    return 0;
+}
+
+int
+crypto_kdf_hkdf_sha256_expand(unsigned char *out, size_t out_len,
+                              const char *ctx, size_t ctx_len,
+                              const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES])
+{
+    crypto_kdf_hkdf_sha256_prk_state state;
+    int                              ret;
+
+    crypto_kdf_hkdf_sha256_prk_init(&state, prk);
+    ret = crypto_kdf_hkdf_sha256_expand_from_state(out, out_len,
+                                                   ctx, ctx_len, &state);
+    sodium_memzero(&state, sizeof state);
+
+    return ret;
+}
+
+int
+crypto_kdf_hkdf_sha256_expand_batch(unsigned char *out, size_t subkey_len,
+                                    const char * const *ctx,
+                                    const size_t *ctx_len, size_t n,
+                                    const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES])
+{
+    crypto_kdf_hkdf_sha256_prk_state state;
+    size_t                           i;
+
+    if (subkey_len > crypto_kdf_hkdf_sha256_BYTES_MAX) {
+        errno = EINVAL;
+        return -1;
+    }
+    crypto_kdf_hkdf_sha256_prk_init(&state, prk);
+    for (i = (size_t) 0U; i < n; i++) {
+        crypto_kdf_hkdf_sha256_expand_from_state(&out[i * subkey_len],
+                                                 subkey_len, ctx[i],
+                                                 ctx_len[i], &state);
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return 0;
+}
@@ -24,6 +24,7 @@
 #include "runtime.h"
 #include "utils.h"
 #include "private/common.h"
+#include "private/thread.h"
 
 #include "argon2-core.h"
 #include "argon2-impl.h"
@@ -267,33 +268,100 @@ uint32_t index_alpha(const argon2_instance_t *instance,
     return absolute_position;
 }
 
-int fill_memory_blocks(argon2_instance_t *instance) {
+static void fill_slice(argon2_thread_data *job, uint8_t slice) {
+    argon2_position_t position = job->pos;
     int result;
-    uint32_t r, s;
+
+    position.slice = slice;
+    for (; position.lane < job->instance_ptr->lanes;
+         position.lane += job->lane_step) {
+        result = fill_segment(job->instance_ptr, position);
+        if (ARGON2_OK != result) {
+            job->result = result; /* LCOV_EXCL_LINE */
+        }
+    }
+}
+
+static void fill_pass_job(void *job_) {
+    argon2_thread_data *job = (argon2_thread_data *) job_;
+    uint32_t s;
+
+    for (s = 0; s < ARGON2_SYNC_POINTS; ++s) {
+        fill_slice(job, (uint8_t)s);
+        /* synchronization point: no lane may start the next slice before
+         * all the lanes have completed this one */
+        sodium_barrier_wait(job->barrier);
+    }
+}
+
+int fill_memory_blocks(argon2_instance_t *instance) {
+    argon2_thread_data jobs[ARGON2_MAX_WORKERS];
+    sodium_thread_t workers[ARGON2_MAX_WORKERS];
+    int started[ARGON2_MAX_WORKERS];
+    sodium_barrier_t barrier;
+    int result = ARGON2_OK;
+    uint32_t njobs;
+    uint32_t r, s, j;
 
     if (instance == NULL || instance->lanes == 0) {
         return ARGON2_OK; /* LCOV_EXCL_LINE */
     }
-
-    for (r = 0; r < instance->passes; ++r) {
+    /* the number of threads is not trusted when verifying a hash: it is
+     * capped, and each thread may process several lanes */
+    njobs = instance->threads < instance->lanes ?
+        instance->threads : instance->lanes;
+    if (njobs > ARGON2_MAX_WORKERS) {
+        njobs = ARGON2_MAX_WORKERS;
+    }
+    if (njobs == 0) {
+        njobs = 1; /* LCOV_EXCL_LINE */
+    }
+    for (r = 0; r < instance->passes && ARGON2_OK == result; ++r) {
+        if (sodium_barrier_init(&barrier, njobs) != 0) {
+            return ARGON2_THREAD_FAIL; /* LCOV_EXCL_LINE */
+        }
+        for (j = 0; j < njobs; ++j) {
+            jobs[j].instance_ptr = instance;
+            jobs[j].barrier = &barrier;
+            jobs[j].pos.pass = r;
+            jobs[j].pos.lane = j;
+            jobs[j].pos.slice = 0;
+            jobs[j].pos.index = 0;
+            jobs[j].lane_step = njobs;
+            jobs[j].result = ARGON2_OK;
+        }
+        /* the workers are started once per pass; the calling thread takes
+         * the first job, and the jobs of the workers that could not start */
+        for (j = 1; j < njobs; ++j) {
+            started[j] = sodium_thread_create(&workers[j], fill_pass_job,
+                                              &jobs[j]) == 0;
+            if (!started[j]) {
+                sodium_barrier_leave(&barrier); /* LCOV_EXCL_LINE */
+            }
+        }
         for (s = 0; s < ARGON2_SYNC_POINTS; ++s) {
-            uint32_t l;
-
-            for (l = 0; l < instance->lanes; ++l) {
-                argon2_position_t position;
-
-                position.pass = r;
-                position.lane = l;
-                position.slice = (uint8_t)s;
-                position.index = 0;
-                result = fill_segment(instance, position);
-                if (ARGON2_OK != result) {
-                    return result; /* LCOV_EXCL_LINE */
+            fill_slice(&jobs[0], (uint8_t)s);
+            for (j = 1; j < njobs; ++j) {
+                if (!started[j]) {
+                    fill_slice(&jobs[j], (uint8_t)s); /* LCOV_EXCL_LINE */
                 }
             }
+            sodium_barrier_wait(&barrier);
+        }
+        for (j = 1; j < njobs; ++j) {
+            if (started[j]) {
+                sodium_thread_join(&workers[j]);
+            }
+        }
+        sodium_barrier_destroy(&barrier);
+        for (j = 0; j < njobs; ++j) {
+            if (ARGON2_OK != jobs[j].result) {
+                result = jobs[j].result; /* LCOV_EXCL_LINE */
+            }
         }
     }
-    return ARGON2_OK;
+
+    return result;
 }
 
 int validate_inputs(const argon2_context *context) {
@@ -15,6 +15,7 @@
 #define argon2_core_H
 
 #include "argon2.h"
+#include "private/thread.h"
 
 /*************************Argon2 internal
  * constants**************************************************/
@@ -94,10 +95,20 @@ typedef struct Argon2_position_t {
     uint32_t index;
 } argon2_position_t;
 
-/*Struct that holds the inputs for thread handling FillSegment*/
+/* Maximum number of threads filling the memory, whatever the number of lanes */
+#define ARGON2_MAX_WORKERS 16U
+
+/*
+ * Struct that holds the inputs for thread handling FillSegment: the lanes
+ * pos.lane, pos.lane + lane_step, ... of every slice of a pass, with a
+ * barrier at every synchronization point
+ */
 typedef struct Argon2_thread_data {
     argon2_instance_t *instance_ptr;
+    sodium_barrier_t *barrier;
     argon2_position_t pos;
+    uint32_t lane_step;
+    int result;
 } argon2_thread_data;
 
 /*************************Argon2 core
@@ -189,7 +200,9 @@ int fill_segment_ref(const argon2_instance_t *instance,
 
 /*
  * Function that fills the entire memory t_cost times based on the first two
- * blocks in each lane
+ * blocks in each lane. The lanes are distributed among up to
+ * min(@instance->threads, ARGON2_MAX_WORKERS) threads, which are started once
+ * per pass and wait for each other at every synchronization point
  * @param instance Pointer to the current instance
  * @return Zero if successful, -1 if memory failed to allocate
  */
@@ -74,30 +74,32 @@ crypto_pwhash_argon2i_memlimit_sensitive(void)
 }
 
 int
-crypto_pwhash_argon2i(unsigned char * const out,
-                      unsigned long long outlen,
-                      const char * const passwd,
-                      unsigned long long passwdlen,
-                      const unsigned char * const salt,
-                      unsigned long long opslimit,
-                      size_t memlimit, int alg)
+crypto_pwhash_argon2i_parallel(unsigned char * const out,
+                               unsigned long long outlen,
+                               const char * const passwd,
+                               unsigned long long passwdlen,
+                               const unsigned char * const salt,
+                               unsigned long long opslimit,
+                               size_t memlimit, size_t parallelism, int alg)
 {
     if (alg != crypto_pwhash_argon2i_ALG_ARGON2I13) {
         return -1;
     }
     memlimit /= 1024U;
     if (outlen > ARGON2_MAX_OUTLEN || passwdlen > ARGON2_MAX_PWD_LENGTH ||
-        opslimit > ARGON2_MAX_TIME || memlimit > ARGON2_MAX_MEMORY) {
+        opslimit > ARGON2_MAX_TIME || memlimit > ARGON2_MAX_MEMORY ||
+        parallelism > ARGON2_MAX_LANES) {
         errno = EFBIG;
         return -1;
     }
     if (outlen < ARGON2_MIN_OUTLEN || passwdlen < ARGON2_MIN_PWD_LENGTH ||
-        opslimit < ARGON2_MIN_TIME || memlimit < ARGON2_MIN_MEMORY) {
+        opslimit < ARGON2_MIN_TIME || memlimit < ARGON2_MIN_MEMORY ||
+        parallelism < ARGON2_MIN_LANES || memlimit < 8U * parallelism) {
         errno = EINVAL;
         return -1;
     }
     if (argon2i_hash_raw((uint32_t) opslimit, (uint32_t) memlimit,
-                         (uint32_t) 1U, passwd, (size_t) passwdlen,
+                         (uint32_t) parallelism, passwd, (size_t) passwdlen,
                          salt, (size_t) crypto_pwhash_argon2i_SALTBYTES,
                          out, (size_t) outlen) != ARGON2_OK) {
         return -1; /* LCOV_EXCL_LINE */
@@ -106,29 +108,44 @@ crypto_pwhash_argon2i(unsigned char * const out,
 }
 
 int
-crypto_pwhash_argon2i_str(char out[crypto_pwhash_argon2i_STRBYTES],
-                          const char * const passwd,
-                          unsigned long long passwdlen,
-                          unsigned long long opslimit,
-                          size_t memlimit)
+crypto_pwhash_argon2i(unsigned char * const out,
+                      unsigned long long outlen,
+                      const char * const passwd,
+                      unsigned long long passwdlen,
+                      const unsigned char * const salt,
+                      unsigned long long opslimit,
+                      size_t memlimit, int alg)
+{
+    return crypto_pwhash_argon2i_parallel(out, outlen, passwd, passwdlen, salt,
+                                          opslimit, memlimit, 1U, alg);
+}
+
+int
+crypto_pwhash_argon2i_str_parallel(char out[crypto_pwhash_argon2i_STRBYTES],
+                                   const char * const passwd,
+                                   unsigned long long passwdlen,
+                                   unsigned long long opslimit,
+                                   size_t memlimit, size_t parallelism)
 {
     unsigned char salt[crypto_pwhash_argon2i_SALTBYTES];
 
     memset(out, 0, crypto_pwhash_argon2i_STRBYTES);
     memlimit /= 1024U;
     if (passwdlen > ARGON2_MAX_PWD_LENGTH ||
-        opslimit > ARGON2_MAX_TIME || memlimit > ARGON2_MAX_MEMORY) {
+        opslimit > ARGON2_MAX_TIME || memlimit > ARGON2_MAX_MEMORY ||
+        parallelism > ARGON2_MAX_LANES) {
         errno = EFBIG;
         return -1;
     }
     if (passwdlen < ARGON2_MIN_PWD_LENGTH ||
-        opslimit < ARGON2_MIN_TIME || memlimit < ARGON2_MIN_MEMORY) {
+        opslimit < ARGON2_MIN_TIME || memlimit < ARGON2_MIN_MEMORY ||
+        parallelism < ARGON2_MIN_LANES || memlimit < 8U * parallelism) {
         errno = EINVAL;
         return -1;
     }
     randombytes_buf(salt, sizeof salt);
     if (argon2i_hash_encoded((uint32_t) opslimit, (uint32_t) memlimit,
-                             (uint32_t) 1U, passwd, (size_t) passwdlen,
+                             (uint32_t) parallelism, passwd, (size_t) passwdlen,
                              salt, sizeof salt, STR_HASHBYTES,
                              out, crypto_pwhash_argon2i_STRBYTES) != ARGON2_OK) {
         return -1; /* LCOV_EXCL_LINE */
@@ -136,6 +153,17 @@ crypto_pwhash_argon2i_str(char out[crypto_pwhash_argon2i_STRBYTES],
     return 0;
 }
 
+int
+crypto_pwhash_argon2i_str(char out[crypto_pwhash_argon2i_STRBYTES],
+                          const char * const passwd,
+                          unsigned long long passwdlen,
+                          unsigned long long opslimit,
+                          size_t memlimit)
+{
+    return crypto_pwhash_argon2i_str_parallel(out, passwd, passwdlen,
+                                              opslimit, memlimit, 1U);
+}
+
 int
 crypto_pwhash_argon2i_str_verify(const char str[crypto_pwhash_argon2i_STRBYTES],
                                  const char * const passwd,
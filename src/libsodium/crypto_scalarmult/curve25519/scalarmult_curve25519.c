@@ -1,7 +1,13 @@
 
+#include <string.h>
+
 #include "crypto_scalarmult_curve25519.h"
+#include "private/curve25519_ref10.h"
 #include "scalarmult_curve25519.h"
 #include "runtime.h"
+#include "utils.h"
+
+#define X25519_BATCH_CHUNK 16
 
 #ifdef HAVE_AVX_ASM
 # include "sandy2x/curve25519_sandy2x.h"
@@ -38,6 +44,52 @@ crypto_scalarmult_curve25519_base(unsigned char *q, const unsigned char *n)
     return implementation->mult_base(q, n);
 }
 
+/*
+ * Computes the fixed-base multiplication on the Edwards curve, and shares
+ * the field inversion required to map every point to its Montgomery
+ * u coordinate, u = (Z + Y) / (Z - Y), across up to X25519_BATCH_CHUNK
+ * points.
+ */
+int
+crypto_scalarmult_curve25519_base_batch(unsigned char *q,
+                                        const unsigned char *n, size_t count)
+{
+    unsigned char e[32];
+    ge_p3         A;
+    fe            num[X25519_BATCH_CHUNK];
+    fe            den[X25519_BATCH_CHUNK];
+    fe            inv[X25519_BATCH_CHUNK];
+    fe            u;
+    size_t        chunk;
+    size_t        i;
+    size_t        j;
+
+    for (i = 0U; i < count; i += chunk) {
+        chunk = count - i;
+        if (chunk > X25519_BATCH_CHUNK) {
+            chunk = X25519_BATCH_CHUNK;
+        }
+        for (j = 0U; j < chunk; j++) {
+            memcpy(e, n + (i + j) * crypto_scalarmult_curve25519_SCALARBYTES,
+                   sizeof e);
+            e[0] &= 248;
+            e[31] &= 127;
+            e[31] |= 64;
+            ge_scalarmult_base(&A, e);
+            fe_add(num[j], A.Z, A.Y);
+            fe_sub(den[j], A.Z, A.Y);
+        }
+        fe_batch_invert(inv, (const fe *) den, chunk);
+        for (j = 0U; j < chunk; j++) {
+            fe_mul(u, num[j], inv[j]);
+            fe_tobytes(q + (i + j) * crypto_scalarmult_curve25519_BYTES, u);
+        }
+    }
+    sodium_memzero(e, sizeof e);
+
+    return 0;
+}
+
 size_t
 crypto_scalarmult_curve25519_bytes(void)
 {
@@ -25,3 +25,11 @@ crypto_shorthash(unsigned char *out, const unsigned char *in,
 {
     return crypto_shorthash_siphash24(out, in, inlen, k);
 }
+
+int
+crypto_shorthash_batch(unsigned char *out, const unsigned char * const *in,
+                       const unsigned long long *inlen, size_t n,
+                       const unsigned char *k)
+{
+    return crypto_shorthash_siphash24_batch(out, in, inlen, n, k);
+}
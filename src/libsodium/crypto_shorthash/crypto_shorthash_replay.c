@@ -0,0 +1,250 @@
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto_shorthash.h"
+#include "randombytes.h"
+#include "utils.h"
+#include "private/common.h"
+#include "private/mutex.h"
+
+#define REPLAY_BLOCKWORDS        8U
+#define REPLAY_ENTRIES_PER_BLOCK 32U
+#define REPLAY_GENERATIONS       3U
+#define REPLAY_NEXT(i)           (((i) + 1U) % REPLAY_GENERATIONS)
+#define REPLAY_PREVIOUS(i)       (((i) + REPLAY_GENERATIONS - 1U) % REPLAY_GENERATIONS)
+#define REPLAY_BLOCK(f, i, b)    ((f)->blocks[(b) * REPLAY_GENERATIONS + (i)])
+
+/*
+ * Readers do not take the lock. The filter words are accessed with relaxed
+ * atomic operations, and the index of the current filter is published with
+ * a release store, after the next filter has been cleared.
+ * Without 64-bit atomics, a reader may see a torn word; since the bits of a
+ * word are either all being set or all being cleared, this is equivalent to
+ * seeing the word a bit earlier or later.
+ */
+#if defined(__ATOMIC_RELAXED) && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && \
+    __GCC_ATOMIC_LLONG_LOCK_FREE == 2
+# define REPLAY_WORD_LOAD(P)     __atomic_load_n((P), __ATOMIC_RELAXED)
+# define REPLAY_WORD_STORE(P, V) __atomic_store_n((P), (V), __ATOMIC_RELAXED)
+#else
+# define REPLAY_WORD_LOAD(P)     (*(const volatile uint64_t *) (P))
+# define REPLAY_WORD_STORE(P, V) (*(volatile uint64_t *) (P) = (V))
+#endif
+#if !defined(__ATOMIC_ACQUIRE)
+# if defined(HAVE_ATOMIC_OPS)
+#  define REPLAY_BARRIER() __sync_synchronize()
+# elif defined(_MSC_VER)
+#  define REPLAY_BARRIER() MemoryBarrier()
+# else
+#  define REPLAY_BARRIER() do { } while (0)
+# endif
+#endif
+
+/*
+ * Each message sets one bit in each of the 8 words of a 64-byte block:
+ * the upper half of its hash selects the block, and the lower half,
+ * multiplied by a different odd constant for every word, selects the bits.
+ * 16 bits per message keep the false positive rate below 0.2%, even when
+ * both checked filters are full.
+ *
+ * Three filters are allocated. Two of them, the current and the previous
+ * ones, are checked. The third one is cleared a block at a time on
+ * insertion, so that it is empty when it becomes the current filter and
+ * the previous filter is never modified while readers may be using it.
+ * The filters are interleaved: the blocks checked for a message are
+ * adjacent, and usually share a page.
+ */
+
+typedef struct ReplayBlock_ {
+    uint64_t w[REPLAY_BLOCKWORDS];
+} ReplayBlock;
+
+struct crypto_shorthash_replay {
+    unsigned char      key[crypto_shorthash_KEYBYTES];
+    sodium_mutex_t     lock;
+    ReplayBlock       *blocks;
+    void              *mem;
+    uint64_t           nblocks;
+    uint64_t           capacity;
+    uint64_t           count;
+    uint64_t           cleared;
+    uint32_t           current;
+};
+
+static const uint32_t replay_salt[REPLAY_BLOCKWORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
+static void
+_replay_hash(const crypto_shorthash_replay *filter, uint64_t *block,
+             uint64_t mask[REPLAY_BLOCKWORDS],
+             const unsigned char *in, unsigned long long inlen)
+{
+    unsigned char h[crypto_shorthash_BYTES];
+    uint64_t      x;
+    uint32_t      lo;
+    size_t        i;
+
+    crypto_shorthash(h, in, inlen, filter->key);
+    x = LOAD64_LE(h);
+    *block = ((x >> 32) * filter->nblocks) >> 32;
+    lo = (uint32_t) x;
+    for (i = 0U; i < REPLAY_BLOCKWORDS; i++) {
+        mask[i] = (uint64_t) 1U << ((uint32_t) (lo * replay_salt[i]) >> 26);
+    }
+}
+
+static uint32_t
+_replay_current_load(const crypto_shorthash_replay *filter)
+{
+#ifdef __ATOMIC_ACQUIRE
+    return __atomic_load_n(&filter->current, __ATOMIC_ACQUIRE);
+#else
+    uint32_t current = *(const volatile uint32_t *) &filter->current;
+
+    REPLAY_BARRIER();
+
+    return current;
+#endif
+}
+
+static void
+_replay_current_store(crypto_shorthash_replay *filter, uint32_t current)
+{
+#ifdef __ATOMIC_RELEASE
+    __atomic_store_n(&filter->current, current, __ATOMIC_RELEASE);
+#else
+    REPLAY_BARRIER();
+    *(volatile uint32_t *) &filter->current = current;
+#endif
+}
+
+static int
+_replay_block_has(const ReplayBlock *block,
+                  const uint64_t mask[REPLAY_BLOCKWORDS])
+{
+    uint64_t missing = 0U;
+    size_t   i;
+
+    for (i = 0U; i < REPLAY_BLOCKWORDS; i++) {
+        missing |= mask[i] & ~REPLAY_WORD_LOAD(&block->w[i]);
+    }
+    return missing == 0U;
+}
+
+crypto_shorthash_replay *
+crypto_shorthash_replay_new(size_t capacity)
+{
+    crypto_shorthash_replay *filter;
+    unsigned char           *mem;
+    uint64_t                 nblocks;
+    size_t                   size;
+
+    if (capacity == 0U ||
+        (uint64_t) capacity > (uint64_t) UINT32_MAX * REPLAY_ENTRIES_PER_BLOCK) {
+        return NULL;
+    }
+    nblocks = ((uint64_t) capacity + REPLAY_ENTRIES_PER_BLOCK - 1U) /
+        REPLAY_ENTRIES_PER_BLOCK;
+    if (nblocks > (SIZE_MAX - 63U) / REPLAY_GENERATIONS / sizeof(ReplayBlock)) {
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+    size = (size_t) nblocks * REPLAY_GENERATIONS * sizeof(ReplayBlock);
+    if ((filter = (crypto_shorthash_replay *)
+         sodium_malloc(sizeof *filter)) == NULL) {
+        return NULL;
+    }
+    /* the filters are not secret, and can be too large to be locked */
+    if ((mem = (unsigned char *) malloc(size + 63U)) == NULL ||
+        sodium_mutex_init(&filter->lock) != 0) {
+        free(mem);
+        sodium_free(filter);
+        return NULL;
+    }
+    filter->mem = mem;
+    mem += (64U - ((uintptr_t) mem & 63U)) & 63U;
+    memset(mem, 0, size);
+    filter->blocks = (ReplayBlock *) (void *) mem;
+    randombytes_buf(filter->key, sizeof filter->key);
+    filter->nblocks = nblocks;
+    filter->capacity = (uint64_t) capacity;
+    filter->count = 0U;
+    filter->cleared = nblocks;
+    filter->current = 0U;
+
+    return filter;
+}
+
+void
+crypto_shorthash_replay_free(crypto_shorthash_replay *filter)
+{
+    if (filter == NULL) {
+        return;
+    }
+    sodium_mutex_destroy(&filter->lock);
+    free(filter->mem);
+    sodium_free(filter);
+}
+
+int
+crypto_shorthash_replay_check(const crypto_shorthash_replay *filter,
+                              const unsigned char *in,
+                              unsigned long long inlen)
+{
+    uint64_t mask[REPLAY_BLOCKWORDS];
+    uint64_t block;
+    uint32_t current = _replay_current_load(filter);
+
+    _replay_hash(filter, &block, mask, in, inlen);
+
+    return _replay_block_has(&REPLAY_BLOCK(filter, current, block), mask) |
+        _replay_block_has(&REPLAY_BLOCK(filter, REPLAY_PREVIOUS(current),
+                                        block), mask);
+}
+
+int
+crypto_shorthash_replay_check_insert(crypto_shorthash_replay *filter,
+                                     const unsigned char *in,
+                                     unsigned long long inlen)
+{
+    uint64_t     mask[REPLAY_BLOCKWORDS];
+    uint64_t     block;
+    ReplayBlock *b;
+    uint32_t     current;
+    size_t       i;
+
+    _replay_hash(filter, &block, mask, in, inlen);
+    if (sodium_mutex_lock(&filter->lock) != 0) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    current = filter->current;
+    if (_replay_block_has(&REPLAY_BLOCK(filter, current, block), mask) |
+        _replay_block_has(&REPLAY_BLOCK(filter, REPLAY_PREVIOUS(current),
+                                        block), mask)) {
+        sodium_mutex_unlock(&filter->lock);
+        return -1;
+    }
+    b = &REPLAY_BLOCK(filter, current, block);
+    for (i = 0U; i < REPLAY_BLOCKWORDS; i++) {
+        REPLAY_WORD_STORE(&b->w[i], b->w[i] | mask[i]);
+    }
+    /* nblocks <= capacity, so the next filter is empty before it is used */
+    if (filter->cleared < filter->nblocks) {
+        b = &REPLAY_BLOCK(filter, REPLAY_NEXT(current), filter->cleared);
+        for (i = 0U; i < REPLAY_BLOCKWORDS; i++) {
+            REPLAY_WORD_STORE(&b->w[i], 0U);
+        }
+        filter->cleared++;
+    }
+    if (++filter->count >= filter->capacity) {
+        filter->count = 0U;
+        filter->cleared = 0U;
+        _replay_current_store(filter, REPLAY_NEXT(current));
+    }
+    sodium_mutex_unlock(&filter->lock);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "crypto_shorthash_siphash13.h"
+#include "private/common.h"
+#include "private/siphash.h"
+
+typedef uint64_t u64;
+typedef uint32_t u32;
+typedef uint8_t   u8;
+
+int crypto_shorthash_siphash13(unsigned char *out, const unsigned char *in,
+                               unsigned long long inlen, const unsigned char *k)
+{
+  /* "somepseudorandomlygeneratedbytes" */
+  u64 v0 = 0x736f6d6570736575ULL;
+  u64 v1 = 0x646f72616e646f6dULL;
+  u64 v2 = 0x6c7967656e657261ULL;
+  u64 v3 = 0x7465646279746573ULL;
+  u64 b;
+  u64 k0 = LOAD64_LE( k );
+  u64 k1 = LOAD64_LE( k + 8 );
+  u64 m;
+  const u8 *end = in + inlen - ( inlen % sizeof( u64 ) );
+  v3 ^= k1;
+  v2 ^= k0;
+  v1 ^= k1;
+  v0 ^= k0;
+
+  for ( ; in != end; in += 8 )
+  {
+    m = LOAD64_LE( in );
+    v3 ^= m;
+    SIPROUND;
+    v0 ^= m;
+  }
+
+  SIPHASH_LAST_WORD( b, in, inlen );
+
+  v3 ^= b;
+  SIPROUND;
+  v0 ^= b;
+  v2 ^= 0xff;
+  SIPROUND;
+  SIPROUND;
+  SIPROUND;
+  b = v0 ^ v1 ^ v2  ^ v3;
+  STORE64_LE( out, b );
+  return 0;
+}
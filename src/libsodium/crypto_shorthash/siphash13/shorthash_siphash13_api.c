@@ -0,0 +1,11 @@
+#include "crypto_shorthash_siphash13.h"
+
+size_t
+crypto_shorthash_siphash13_bytes(void) {
+    return crypto_shorthash_siphash13_BYTES;
+}
+
+size_t
+crypto_shorthash_siphash13_keybytes(void) {
+    return crypto_shorthash_siphash13_KEYBYTES;
+}
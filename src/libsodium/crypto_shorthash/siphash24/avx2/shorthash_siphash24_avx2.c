@@ -0,0 +1,188 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "shorthash_siphash24_avx2.h"
+
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+
+#pragma GCC target("sse2")
+#pragma GCC target("ssse3")
+#pragma GCC target("sse4.1")
+#pragma GCC target("avx2")
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#include "private/common.h"
+#include "private/siphash.h"
+
+#define ADD(x, y)  _mm256_add_epi64((x), (y))
+#define XOR(x, y)  _mm256_xor_si256((x), (y))
+#define ROTL(x, n) _mm256_or_si256(_mm256_slli_epi64((x), (n)), \
+                                   _mm256_srli_epi64((x), 64 - (n)))
+#define ROTL16(x)  _mm256_shuffle_epi8((x), rot16)
+#define ROTL32(x)  _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+
+#define SIPROUND4                                                     \
+    do {                                                              \
+        v0 = ADD(v0, v1); v1 = ROTL(v1, 13); v1 = XOR(v1, v0); v0 = ROTL32(v0); \
+        v2 = ADD(v2, v3); v3 = ROTL16(v3);   v3 = XOR(v3, v2);        \
+        v0 = ADD(v0, v3); v3 = ROTL(v3, 21); v3 = XOR(v3, v0);        \
+        v2 = ADD(v2, v1); v1 = ROTL(v1, 17); v1 = XOR(v1, v2); v2 = ROTL32(v2); \
+    } while (0)
+
+#define SIPHASH4_INIT                                                 \
+    const __m256i rot16 = _mm256_setr_epi8(6, 7, 0, 1, 2, 3, 4, 5,    \
+                                           14, 15, 8, 9, 10, 11, 12, 13, \
+                                           6, 7, 0, 1, 2, 3, 4, 5,    \
+                                           14, 15, 8, 9, 10, 11, 12, 13); \
+    const __m256i k0 = _mm256_set1_epi64x((long long) LOAD64_LE(k));  \
+    const __m256i k1 = _mm256_set1_epi64x((long long) LOAD64_LE(k + 8)); \
+    __m256i v0 = XOR(k0, _mm256_set1_epi64x(0x736f6d6570736575LL));   \
+    __m256i v1 = XOR(k1, _mm256_set1_epi64x(0x646f72616e646f6dLL));   \
+    __m256i v2 = XOR(k0, _mm256_set1_epi64x(0x6c7967656e657261LL));   \
+    __m256i v3 = XOR(k1, _mm256_set1_epi64x(0x7465646279746573LL))
+
+#define SIPHASH4_FINAL                                                \
+    do {                                                              \
+        v2 = XOR(v2, _mm256_set1_epi64x(0xff));                       \
+        SIPROUND4;                                                    \
+        SIPROUND4;                                                    \
+        SIPROUND4;                                                    \
+        SIPROUND4;                                                    \
+        _mm256_storeu_si256((__m256i *) (void *) out,                 \
+                            XOR(XOR(v0, v1), XOR(v2, v3)));           \
+    } while (0)
+
+static inline __m256i
+siphash4_word(const unsigned char * const in[4], size_t off)
+{
+    return _mm256_set_epi64x((long long) LOAD64_LE(in[3] + off),
+                             (long long) LOAD64_LE(in[2] + off),
+                             (long long) LOAD64_LE(in[1] + off),
+                             (long long) LOAD64_LE(in[0] + off));
+}
+
+static inline uint64_t
+siphash_last_word(const unsigned char *in, unsigned long long inlen)
+{
+    uint64_t b;
+    unsigned left = (unsigned) (inlen & 7U);
+
+    if (inlen >= 8U) {
+        /* overlapping load instead of a byte loop */
+        b = LOAD64_LE(in + inlen - 8U);
+        b = left == 0U ? 0U : b >> (64U - 8U * left);
+        return b | ((uint64_t) inlen << 56);
+    }
+    SIPHASH_LAST_WORD(b, in, inlen);
+
+    return b;
+}
+
+/* All four inputs have the same number of words: no masking is needed */
+static inline void
+siphash24_words4(unsigned char out[32], const unsigned char * const in[4],
+                 const unsigned long long inlen[4], const size_t full_words,
+                 const unsigned char *k)
+{
+    SIPHASH4_INIT;
+    __m256i m;
+    size_t  off;
+
+    for (off = 0U; off < full_words * 8U; off += 8U) {
+        m = siphash4_word(in, off);
+        v3 = XOR(v3, m);
+        SIPROUND4;
+        SIPROUND4;
+        v0 = XOR(v0, m);
+    }
+    m = _mm256_set_epi64x((long long) siphash_last_word(in[3], inlen[3]),
+                          (long long) siphash_last_word(in[2], inlen[2]),
+                          (long long) siphash_last_word(in[1], inlen[1]),
+                          (long long) siphash_last_word(in[0], inlen[0]));
+    v3 = XOR(v3, m);
+    SIPROUND4;
+    SIPROUND4;
+    v0 = XOR(v0, m);
+    SIPHASH4_FINAL;
+}
+
+void
+crypto_shorthash_siphash24_avx2_words4(unsigned char out[32],
+                                       const unsigned char * const in[4],
+                                       const unsigned long long inlen[4],
+                                       const unsigned char *k)
+{
+    const size_t full_words = (size_t) (inlen[0] / 8U);
+
+    /* constant lengths let the compiler unroll the common cases */
+    if (full_words == 1U) {
+        siphash24_words4(out, in, inlen, 1U, k);
+    } else if (full_words == 2U) {
+        siphash24_words4(out, in, inlen, 2U, k);
+    } else {
+        siphash24_words4(out, in, inlen, full_words, k);
+    }
+}
+
+/*
+ * Lanes with shorter inputs keep their state unchanged once their last word
+ * has been absorbed, then all lanes are finalized together.
+ */
+void
+crypto_shorthash_siphash24_avx2_lanes4(unsigned char out[32],
+                                       const unsigned char * const in[4],
+                                       const unsigned long long inlen[4],
+                                       const unsigned char *k)
+{
+    SIPHASH4_INIT;
+    __m256i            m, active;
+    __m256i            s0, s1, s2, s3;
+    const unsigned char *p[4];
+    unsigned char      tail[4][16];
+    unsigned long long words[4];
+    unsigned long long max_words = 0U;
+    unsigned long long j;
+    size_t             l;
+
+    for (l = 0U; l < 4U; l++) {
+        words[l] = inlen[l] / 8U + 1U;
+        if (words[l] > max_words) {
+            max_words = words[l];
+        }
+        /* the last word, followed by a zero word for the inactive steps */
+        STORE64_LE(tail[l], siphash_last_word(in[l], inlen[l]));
+        STORE64_LE(tail[l] + 8, 0U);
+    }
+    for (j = 0U; j < max_words; j++) {
+        /* selects pointers rather than words, so that this compiles to cmov */
+        for (l = 0U; l < 4U; l++) {
+            p[l] = j + 1U < words[l] ? in[l] + j * 8U :
+                   &tail[l][j + 1U == words[l] ? 0 : 8];
+        }
+        active = _mm256_cmpgt_epi64(_mm256_set_epi64x((long long) words[3],
+                                                      (long long) words[2],
+                                                      (long long) words[1],
+                                                      (long long) words[0]),
+                                    _mm256_set1_epi64x((long long) j));
+        m = _mm256_set_epi64x((long long) LOAD64_LE(p[3]),
+                              (long long) LOAD64_LE(p[2]),
+                              (long long) LOAD64_LE(p[1]),
+                              (long long) LOAD64_LE(p[0]));
+        s0 = v0; s1 = v1; s2 = v2; s3 = v3;
+        v3 = XOR(v3, m);
+        SIPROUND4;
+        SIPROUND4;
+        v0 = XOR(v0, m);
+        v0 = _mm256_blendv_epi8(s0, v0, active);
+        v1 = _mm256_blendv_epi8(s1, v1, active);
+        v2 = _mm256_blendv_epi8(s2, v2, active);
+        v3 = _mm256_blendv_epi8(s3, v3, active);
+    }
+    SIPHASH4_FINAL;
+}
+
+#endif
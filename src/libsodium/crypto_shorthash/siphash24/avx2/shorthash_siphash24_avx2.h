@@ -0,0 +1,12 @@
+#include <stddef.h>
+#include <stdint.h>
+
+void crypto_shorthash_siphash24_avx2_lanes4(unsigned char out[32],
+                                            const unsigned char * const in[4],
+                                            const unsigned long long inlen[4],
+                                            const unsigned char *k);
+
+void crypto_shorthash_siphash24_avx2_words4(unsigned char out[32],
+                                            const unsigned char * const in[4],
+                                            const unsigned long long inlen[4],
+                                            const unsigned char *k);
@@ -1,20 +1,11 @@
 #include "crypto_shorthash_siphash24.h"
 #include "private/common.h"
+#include "private/siphash.h"
 
 typedef uint64_t u64;
 typedef uint32_t u32;
 typedef uint8_t   u8;
 
-#define ROTL(x,b) (u64)( ((x) << (b)) | ( (x) >> (64 - (b))) )
-
-#define SIPROUND            \
-  do {              \
-    v0 += v1; v1=ROTL(v1,13); v1 ^= v0; v0=ROTL(v0,32); \
-    v2 += v3; v3=ROTL(v3,16); v3 ^= v2;     \
-    v0 += v3; v3=ROTL(v3,21); v3 ^= v0;     \
-    v2 += v1; v1=ROTL(v1,17); v1 ^= v2; v2=ROTL(v2,32); \
-  } while(0)
-
 int crypto_shorthash_siphash24(unsigned char *out, const unsigned char *in,
                                unsigned long long inlen, const unsigned char *k)
 {
@@ -28,8 +19,6 @@ int crypto_shorthash_siphash24(unsigned char *out, const unsigned char *in,
   u64 k1 = LOAD64_LE( k + 8 );
   u64 m;
   const u8 *end = in + inlen - ( inlen % sizeof( u64 ) );
-  const int left = inlen & 7;
-  b = ( ( u64 )inlen ) << 56;
   v3 ^= k1;
   v2 ^= k0;
   v1 ^= k1;
@@ -44,17 +33,7 @@ int crypto_shorthash_siphash24(unsigned char *out, const unsigned char *in,
     v0 ^= m;
   }
 
-  switch( left )
-  {
-  case 7: b |= ( ( u64 )in[ 6] )  << 48;
-  case 6: b |= ( ( u64 )in[ 5] )  << 40;
-  case 5: b |= ( ( u64 )in[ 4] )  << 32;
-  case 4: b |= ( ( u64 )in[ 3] )  << 24;
-  case 3: b |= ( ( u64 )in[ 2] )  << 16;
-  case 2: b |= ( ( u64 )in[ 1] )  <<  8;
-  case 1: b |= ( ( u64 )in[ 0] ); break;
-  case 0: break;
-  }
+  SIPHASH_LAST_WORD( b, in, inlen );
 
   v3 ^= b;
   SIPROUND;
@@ -69,4 +48,3 @@ int crypto_shorthash_siphash24(unsigned char *out, const unsigned char *in,
   STORE64_LE( out, b );
   return 0;
 }
-
@@ -0,0 +1,130 @@
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto_shorthash_siphash24.h"
+#include "runtime.h"
+#include "../avx2/shorthash_siphash24_avx2.h"
+
+#define BATCH_CHUNK   64U
+#define BATCH_BUCKETS 9U
+
+typedef void (*siphash24_lanes4_fn)(unsigned char out[32],
+                                    const unsigned char * const in[4],
+                                    const unsigned long long inlen[4],
+                                    const unsigned char *k);
+
+static siphash24_lanes4_fn siphash24_lanes4 = NULL;
+static siphash24_lanes4_fn siphash24_words4 = NULL;
+
+static void
+siphash24_batch_group(unsigned char *out, const unsigned char * const *in,
+                      const unsigned long long *inlen, const size_t idx[4],
+                      const unsigned char *k)
+{
+    unsigned char        h[4 * crypto_shorthash_siphash24_BYTES];
+    const unsigned char *lane_in[4];
+    unsigned long long   lane_inlen[4];
+    size_t               l;
+
+    for (l = 0U; l < 4U; l++) {
+        lane_in[l] = in[idx[l]];
+        lane_inlen[l] = inlen[idx[l]];
+    }
+    if (lane_inlen[0] / 8U == lane_inlen[1] / 8U &&
+        lane_inlen[0] / 8U == lane_inlen[2] / 8U &&
+        lane_inlen[0] / 8U == lane_inlen[3] / 8U) {
+        siphash24_words4(h, lane_in, lane_inlen, k);
+    } else {
+        siphash24_lanes4(h, lane_in, lane_inlen, k);
+    }
+    for (l = 0U; l < 4U; l++) {
+        memcpy(out + idx[l] * crypto_shorthash_siphash24_BYTES,
+               h + l * crypto_shorthash_siphash24_BYTES,
+               crypto_shorthash_siphash24_BYTES);
+    }
+}
+
+/*
+ * Inputs are processed in chunks. Runs of four inputs with the same number
+ * of 64-bit words are hashed in place; the others are grouped by number of
+ * words within the chunk, so that the four lanes of a group usually finish
+ * at the same time. Inputs of 64 bytes or more share the last bucket.
+ */
+int
+crypto_shorthash_siphash24_batch(unsigned char *out,
+                                 const unsigned char * const *in,
+                                 const unsigned long long *inlen,
+                                 size_t n, const unsigned char *k)
+{
+    size_t bucket[BATCH_BUCKETS][BATCH_CHUNK];
+    size_t count[BATCH_BUCKETS];
+    size_t rest[BATCH_CHUNK];
+    size_t nrest;
+    size_t base = 0U;
+    size_t chunk;
+    size_t b;
+    size_t i;
+    size_t j;
+
+    if (siphash24_lanes4 != NULL) {
+        for (; n - base >= 4U; base += chunk) {
+            chunk = n - base < BATCH_CHUNK ? n - base : BATCH_CHUNK;
+            memset(count, 0, sizeof count);
+            for (i = base; i < base + chunk; i++) {
+                if (i + 4U <= base + chunk && (i - base) % 4U == 0U &&
+                    inlen[i] / 8U == inlen[i + 1] / 8U &&
+                    inlen[i] / 8U == inlen[i + 2] / 8U &&
+                    inlen[i] / 8U == inlen[i + 3] / 8U) {
+                    siphash24_words4(out + i * crypto_shorthash_siphash24_BYTES,
+                                     &in[i], &inlen[i], k);
+                    i += 3U;
+                    continue;
+                }
+                b = inlen[i] / 8U < BATCH_BUCKETS - 1U ?
+                    (size_t) (inlen[i] / 8U) : BATCH_BUCKETS - 1U;
+                bucket[b][count[b]++] = i;
+            }
+            nrest = 0U;
+            for (b = 0U; b < BATCH_BUCKETS; b++) {
+                for (j = 0U; count[b] - j >= 4U; j += 4U) {
+                    siphash24_batch_group(out, in, inlen, &bucket[b][j], k);
+                }
+                for (; j < count[b]; j++) {
+                    rest[nrest++] = bucket[b][j];
+                }
+            }
+            for (j = 0U; nrest - j >= 4U; j += 4U) {
+                siphash24_batch_group(out, in, inlen, &rest[j], k);
+            }
+            for (; j < nrest; j++) {
+                crypto_shorthash_siphash24
+                    (out + rest[j] * crypto_shorthash_siphash24_BYTES,
+                     in[rest[j]], inlen[rest[j]], k);
+            }
+        }
+    }
+    for (i = base; i < n; i++) {
+        crypto_shorthash_siphash24(out + i * crypto_shorthash_siphash24_BYTES,
+                                   in[i], inlen[i], k);
+    }
+    return 0;
+}
+
+int
+_crypto_shorthash_siphash24_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+    siphash24_lanes4 = NULL;
+    siphash24_words4 = NULL;
+#if defined(HAVE_AVX2INTRIN_H) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)) && _MSC_VER >= 1700)
+    if (sodium_runtime_has_avx2()) {
+        siphash24_lanes4 = crypto_shorthash_siphash24_avx2_lanes4;
+        siphash24_words4 = crypto_shorthash_siphash24_avx2_words4;
+    }
+#endif
+    return 0;
+/* LCOV_EXCL_STOP */
+}
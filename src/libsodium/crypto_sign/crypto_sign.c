@@ -1,6 +1,12 @@
 
 #include "crypto_sign.h"
 
+size_t
+crypto_sign_statebytes(void)
+{
+    return sizeof(crypto_sign_state);
+}
+
 size_t
 crypto_sign_bytes(void)
 {
@@ -44,6 +50,19 @@ crypto_sign_keypair(unsigned char *pk, unsigned char *sk)
     return crypto_sign_ed25519_keypair(pk, sk);
 }
 
+int
+crypto_sign_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                               const unsigned char *seeds, size_t n)
+{
+    return crypto_sign_ed25519_seed_keypair_batch(pks, sks, seeds, n);
+}
+
+int
+crypto_sign_keypair_batch(unsigned char *pks, unsigned char *sks, size_t n)
+{
+    return crypto_sign_ed25519_keypair_batch(pks, sks, n);
+}
+
 int
 crypto_sign(unsigned char *sm, unsigned long long *smlen_p,
             const unsigned char *m, unsigned long long mlen,
@@ -74,3 +93,30 @@ crypto_sign_verify_detached(const unsigned char *sig, const unsigned char *m,
 {
     return crypto_sign_ed25519_verify_detached(sig, m, mlen, pk);
 }
+
+int
+crypto_sign_init(crypto_sign_state *state)
+{
+    return crypto_sign_ed25519ph_init(state);
+}
+
+int
+crypto_sign_update(crypto_sign_state *state, const unsigned char *m,
+                   unsigned long long mlen)
+{
+    return crypto_sign_ed25519ph_update(state, m, mlen);
+}
+
+int
+crypto_sign_final_create(crypto_sign_state *state, unsigned char *sig,
+                         unsigned long long *siglen_p, const unsigned char *sk)
+{
+    return crypto_sign_ed25519ph_final_create(state, sig, siglen_p, sk);
+}
+
+int
+crypto_sign_final_verify(crypto_sign_state *state, const unsigned char *sig,
+                         const unsigned char *pk)
+{
+    return crypto_sign_ed25519ph_final_verify(state, sig, pk);
+}
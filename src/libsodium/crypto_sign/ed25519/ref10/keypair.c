@@ -1,4 +1,5 @@
 
+#include <stdint.h>
 #include <string.h>
 
 #include "crypto_hash_sha512.h"
@@ -8,6 +9,8 @@
 #include "randombytes.h"
 #include "utils.h"
 
+#define ED25519_BATCH_CHUNK 16
+
 int
 crypto_sign_ed25519_seed_keypair(unsigned char *pk, unsigned char *sk,
                                  const unsigned char *seed)
@@ -41,6 +44,65 @@ crypto_sign_ed25519_keypair(unsigned char *pk, unsigned char *sk)
     return ret;
 }
 
+static void
+_crypto_sign_ed25519_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                        const unsigned char *seeds,
+                                        size_t seeds_stride, size_t n)
+{
+    unsigned char az[64];
+    fe            recip[ED25519_BATCH_CHUNK];
+    ge_p3         A[ED25519_BATCH_CHUNK];
+    size_t        chunk;
+    size_t        i;
+    size_t        j;
+
+    for (i = 0U; i < n; i += chunk) {
+        chunk = n - i;
+        if (chunk > ED25519_BATCH_CHUNK) {
+            chunk = ED25519_BATCH_CHUNK;
+        }
+        for (j = 0U; j < chunk; j++) {
+            crypto_hash_sha512(az, seeds + (i + j) * seeds_stride, 32);
+            az[0] &= 248;
+            az[31] &= 63;
+            az[31] |= 64;
+            ge_scalarmult_base(&A[j], az);
+        }
+        ge_p3_batch_tobytes(pks + i * 32U, recip, A, chunk);
+        for (j = 0U; j < chunk; j++) {
+            memmove(sks + (i + j) * 64U, seeds + (i + j) * seeds_stride, 32);
+            memmove(sks + (i + j) * 64U + 32U, pks + (i + j) * 32U, 32);
+        }
+    }
+    sodium_memzero(az, sizeof az);
+}
+
+int
+crypto_sign_ed25519_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                       const unsigned char *seeds, size_t n)
+{
+    if (n > SIZE_MAX / 64U) {
+        return -1;
+    }
+    _crypto_sign_ed25519_seed_keypair_batch(pks, sks, seeds, 32U, n);
+
+    return 0;
+}
+
+int
+crypto_sign_ed25519_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                  size_t n)
+{
+    if (n > SIZE_MAX / 64U) {
+        return -1;
+    }
+    /* seeds are drawn in place: the first half of every secret key */
+    randombytes_buf(sks, n * 64U);
+    _crypto_sign_ed25519_seed_keypair_batch(pks, sks, sks, 64U, n);
+
+    return 0;
+}
+
 int
 crypto_sign_ed25519_pk_to_curve25519(unsigned char *curve25519_pk,
                                      const unsigned char *ed25519_pk)
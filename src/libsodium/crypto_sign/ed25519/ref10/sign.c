@@ -3,45 +3,104 @@
 
 #include "crypto_hash_sha512.h"
 #include "crypto_sign_ed25519.h"
+#include "sign_ed25519_ref10.h"
 #include "utils.h"
 #include "private/curve25519_ref10.h"
 
+#define ED25519_BATCH_CHUNK 16
+
+void
+_crypto_sign_ed25519_ref10_hinit(crypto_hash_sha512_state *hs, int prehashed)
+{
+    static const unsigned char DOM2PREFIX[32 + 2] = {
+        'S', 'i', 'g', 'E', 'd', '2', '5', '5', '1', '9', ' ',
+        'n', 'o', ' ',
+        'E', 'd', '2', '5', '5', '1', '9', ' ',
+        'c', 'o', 'l', 'l', 'i', 's', 'i', 'o', 'n', 's', 1, 0
+    };
+
+    crypto_hash_sha512_init(hs);
+    if (prehashed) {
+        crypto_hash_sha512_update(hs, DOM2PREFIX, sizeof DOM2PREFIX);
+    }
+}
+
 int
-crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
-                             const unsigned char *m, unsigned long long mlen,
-                             const unsigned char *sk)
+crypto_sign_ed25519_sk_to_expandedsk(crypto_sign_ed25519_expandedsk *esk,
+                                     const unsigned char *sk)
 {
-    crypto_hash_sha512_state hs;
-    unsigned char az[64];
-    unsigned char nonce[64];
-    unsigned char hram[64];
-    ge_p3 R;
+    crypto_hash_sha512(esk->az, sk, 32);
+    esk->az[0] &= 248;
+    esk->az[31] &= 63;
+    esk->az[31] |= 64;
+
+    memmove(esk->pk, sk + 32, 32);
+
+    _crypto_sign_ed25519_ref10_hinit(&esk->nonce_hs, 0);
+    crypto_hash_sha512_update(&esk->nonce_hs, esk->az + 32, 32);
 
-    crypto_hash_sha512(az, sk, 32);
-    az[0] &= 248;
-    az[31] &= 63;
-    az[31] |= 64;
+    return 0;
+}
+
+static void
+_crypto_sign_ed25519_nonce(unsigned char *nonce,
+                           const unsigned char *m, unsigned long long mlen,
+                           const crypto_sign_ed25519_expandedsk *esk,
+                           int prehashed)
+{
+    crypto_hash_sha512_state hs;
 
-    crypto_hash_sha512_init(&hs);
-    crypto_hash_sha512_update(&hs, az + 32, 32);
+    if (prehashed) {
+        _crypto_sign_ed25519_ref10_hinit(&hs, 1);
+        crypto_hash_sha512_update(&hs, esk->az + 32, 32);
+    } else {
+        memcpy(&hs, &esk->nonce_hs, sizeof hs);
+    }
     crypto_hash_sha512_update(&hs, m, mlen);
     crypto_hash_sha512_final(&hs, nonce);
 
-    memmove(sig + 32, sk + 32, 32);
-
     sc_reduce(nonce);
-    ge_scalarmult_base(&R, nonce);
-    ge_p3_tobytes(sig, &R);
+}
+
+/* sig[0..31] must already contain the encoded R */
+static void
+_crypto_sign_ed25519_finish(unsigned char *sig,
+                            const unsigned char *m, unsigned long long mlen,
+                            const unsigned char *nonce,
+                            const crypto_sign_ed25519_expandedsk *esk,
+                            int prehashed)
+{
+    crypto_hash_sha512_state hs;
+    unsigned char hram[64];
+
+    memmove(sig + 32, esk->pk, 32);
 
-    crypto_hash_sha512_init(&hs);
+    _crypto_sign_ed25519_ref10_hinit(&hs, prehashed);
     crypto_hash_sha512_update(&hs, sig, 64);
     crypto_hash_sha512_update(&hs, m, mlen);
     crypto_hash_sha512_final(&hs, hram);
 
     sc_reduce(hram);
-    sc_muladd(sig + 32, hram, az, nonce);
+    sc_muladd(sig + 32, hram, esk->az, nonce);
+}
+
+static int
+_crypto_sign_ed25519_detached_expandedsk(unsigned char *sig,
+                                         unsigned long long *siglen_p,
+                                         const unsigned char *m,
+                                         unsigned long long mlen,
+                                         const crypto_sign_ed25519_expandedsk *esk,
+                                         int prehashed)
+{
+    unsigned char nonce[64];
+    ge_p3 R;
 
-    sodium_memzero(az, sizeof az);
+    _crypto_sign_ed25519_nonce(nonce, m, mlen, esk, prehashed);
+    ge_scalarmult_base(&R, nonce);
+    ge_p3_tobytes(sig, &R);
+    _crypto_sign_ed25519_finish(sig, m, mlen, nonce, esk, prehashed);
+
+    sodium_memzero(nonce, sizeof nonce);
 
     if (siglen_p != NULL) {
         *siglen_p = 64U;
@@ -49,6 +108,82 @@ crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
     return 0;
 }
 
+int
+crypto_sign_ed25519_detached_expandedsk(unsigned char *sig,
+                                        unsigned long long *siglen_p,
+                                        const unsigned char *m,
+                                        unsigned long long mlen,
+                                        const crypto_sign_ed25519_expandedsk *esk)
+{
+    return _crypto_sign_ed25519_detached_expandedsk(sig, siglen_p, m, mlen,
+                                                    esk, 0);
+}
+
+static int
+_crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
+                              const unsigned char *m, unsigned long long mlen,
+                              const unsigned char *sk, int prehashed)
+{
+    crypto_sign_ed25519_expandedsk esk;
+    int                            ret;
+
+    crypto_sign_ed25519_sk_to_expandedsk(&esk, sk);
+    ret = _crypto_sign_ed25519_detached_expandedsk(sig, siglen_p, m, mlen,
+                                                   &esk, prehashed);
+    sodium_memzero(&esk, sizeof esk);
+
+    return ret;
+}
+
+int
+crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
+                             const unsigned char *m, unsigned long long mlen,
+                             const unsigned char *sk)
+{
+    return _crypto_sign_ed25519_detached(sig, siglen_p, m, mlen, sk, 0);
+}
+
+int
+crypto_sign_ed25519_detached_batch(unsigned char *sigs,
+                                   const unsigned char * const *msgs,
+                                   const unsigned long long *mlens,
+                                   size_t n, const unsigned char *sk)
+{
+    crypto_sign_ed25519_expandedsk esk;
+    unsigned char                  nonces[ED25519_BATCH_CHUNK][64];
+    unsigned char                  Rs[ED25519_BATCH_CHUNK * 32];
+    fe                             recip[ED25519_BATCH_CHUNK];
+    ge_p3                          R[ED25519_BATCH_CHUNK];
+    unsigned char                 *sig;
+    size_t                         chunk;
+    size_t                         i;
+    size_t                         j;
+
+    crypto_sign_ed25519_sk_to_expandedsk(&esk, sk);
+    for (i = 0U; i < n; i += chunk) {
+        chunk = n - i;
+        if (chunk > ED25519_BATCH_CHUNK) {
+            chunk = ED25519_BATCH_CHUNK;
+        }
+        for (j = 0U; j < chunk; j++) {
+            _crypto_sign_ed25519_nonce(nonces[j], msgs[i + j], mlens[i + j],
+                                       &esk, 0);
+            ge_scalarmult_base(&R[j], nonces[j]);
+        }
+        ge_p3_batch_tobytes(Rs, recip, R, chunk);
+        for (j = 0U; j < chunk; j++) {
+            sig = sigs + (i + j) * crypto_sign_ed25519_BYTES;
+            memcpy(sig, Rs + j * 32, 32);
+            _crypto_sign_ed25519_finish(sig, msgs[i + j], mlens[i + j],
+                                        nonces[j], &esk, 0);
+        }
+    }
+    sodium_memzero(nonces, sizeof nonces);
+    sodium_memzero(&esk, sizeof esk);
+
+    return 0;
+}
+
 int
 crypto_sign_ed25519(unsigned char *sm, unsigned long long *smlen_p,
                     const unsigned char *m, unsigned long long mlen,
@@ -75,3 +210,30 @@ crypto_sign_ed25519(unsigned char *sm, unsigned long long *smlen_p,
     }
     return 0;
 }
+
+int
+crypto_sign_ed25519ph_init(crypto_sign_ed25519ph_state *state)
+{
+    crypto_hash_sha512_init(&state->hs);
+    return 0;
+}
+
+int
+crypto_sign_ed25519ph_update(crypto_sign_ed25519ph_state *state,
+                             const unsigned char *m, unsigned long long mlen)
+{
+    return crypto_hash_sha512_update(&state->hs, m, mlen);
+}
+
+int
+crypto_sign_ed25519ph_final_create(crypto_sign_ed25519ph_state *state,
+                                   unsigned char               *sig,
+                                   unsigned long long          *siglen_p,
+                                   const unsigned char         *sk)
+{
+    unsigned char ph[crypto_hash_sha512_BYTES];
+
+    crypto_hash_sha512_final(&state->hs, ph);
+
+    return _crypto_sign_ed25519_detached(sig, siglen_p, ph, sizeof ph, sk, 1);
+}
@@ -0,0 +1,9 @@
+#ifndef sign_ed25519_ref10_H
+#define sign_ed25519_ref10_H
+
+#include "crypto_hash_sha512.h"
+
+void _crypto_sign_ed25519_ref10_hinit(crypto_hash_sha512_state *hs,
+                                      int prehashed);
+
+#endif
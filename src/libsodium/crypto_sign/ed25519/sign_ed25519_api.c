@@ -23,6 +23,16 @@ crypto_sign_ed25519_secretkeybytes(void) {
     return crypto_sign_ed25519_SECRETKEYBYTES;
 }
 
+size_t
+crypto_sign_ed25519ph_statebytes(void) {
+    return sizeof(crypto_sign_ed25519ph_state);
+}
+
+size_t
+crypto_sign_ed25519_expandedskbytes(void) {
+    return sizeof(crypto_sign_ed25519_expandedsk);
+}
+
 int
 crypto_sign_ed25519_sk_to_seed(unsigned char *seed, const unsigned char *sk)
 {
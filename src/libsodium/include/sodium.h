@@ -20,9 +20,13 @@
 #include "sodium/crypto_core_salsa208.h"
 #include "sodium/crypto_generichash.h"
 #include "sodium/crypto_generichash_blake2b.h"
+#include "sodium/crypto_generichash_blake2bp.h"
+#include "sodium/crypto_generichash_blake2s.h"
 #include "sodium/crypto_hash.h"
 #include "sodium/crypto_hash_sha256.h"
 #include "sodium/crypto_hash_sha512.h"
+#include "sodium/crypto_kdf_hkdf_sha256.h"
+#include "sodium/crypto_kdf_hkdf_sha512.h"
 #include "sodium/crypto_onetimeauth.h"
 #include "sodium/crypto_onetimeauth_poly1305.h"
 #include "sodium/crypto_pwhash.h"
@@ -34,6 +38,7 @@
 #include "sodium/crypto_secretbox_xsalsa20poly1305.h"
 #include "sodium/crypto_secretbox_xchacha20poly1305.h"
 #include "sodium/crypto_shorthash.h"
+#include "sodium/crypto_shorthash_siphash13.h"
 #include "sodium/crypto_shorthash_siphash24.h"
 #include "sodium/crypto_sign.h"
 #include "sodium/crypto_sign_ed25519.h"
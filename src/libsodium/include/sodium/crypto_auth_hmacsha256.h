@@ -33,6 +33,12 @@ int crypto_auth_hmacsha256_verify(const unsigned char *h,
                                   const unsigned char *k)
             __attribute__ ((warn_unused_result));
 
+SODIUM_EXPORT
+int crypto_auth_hmacsha256_multi(unsigned char *out,
+                                 const unsigned char * const *in,
+                                 const unsigned long long *inlen, size_t n,
+                                 const unsigned char *k);
+
 /* ------------------------------------------------------------------------- */
 
 typedef struct crypto_auth_hmacsha256_state {
@@ -56,6 +62,42 @@ SODIUM_EXPORT
 int crypto_auth_hmacsha256_final(crypto_auth_hmacsha256_state *state,
                                  unsigned char *out);
 
+/* ------------------------------------------------------------------------- */
+
+/*
+ * A keyed state holds the inner and outer hash states after the key has
+ * been absorbed, so that computing a tag doesn't hash the padded key again.
+ */
+
+typedef struct crypto_auth_hmacsha256_keyed_state {
+    uint32_t istate[8];
+    uint32_t ostate[8];
+} crypto_auth_hmacsha256_keyed_state;
+SODIUM_EXPORT
+size_t crypto_auth_hmacsha256_keyed_statebytes(void);
+
+SODIUM_EXPORT
+int crypto_auth_hmacsha256_keyed_init(crypto_auth_hmacsha256_keyed_state *kstate,
+                                      const unsigned char *key,
+                                      size_t keylen);
+
+SODIUM_EXPORT
+int crypto_auth_hmacsha256_keyed_start(crypto_auth_hmacsha256_state *state,
+                                       const crypto_auth_hmacsha256_keyed_state *kstate);
+
+SODIUM_EXPORT
+int crypto_auth_hmacsha256_keyed(unsigned char *out,
+                                 const unsigned char *in,
+                                 unsigned long long inlen,
+                                 const crypto_auth_hmacsha256_keyed_state *kstate);
+
+SODIUM_EXPORT
+int crypto_auth_hmacsha256_keyed_verify(const unsigned char *h,
+                                        const unsigned char *in,
+                                        unsigned long long inlen,
+                                        const crypto_auth_hmacsha256_keyed_state *kstate)
+            __attribute__ ((warn_unused_result));
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,20 @@ int crypto_box_seed_keypair(unsigned char *pk, unsigned char *sk,
 SODIUM_EXPORT
 int crypto_box_keypair(unsigned char *pk, unsigned char *sk);
 
+/*
+ * Generate n key pairs at once. Public and secret keys are stored
+ * consecutively in pks and sks.
+ * Each key pair is the same as the one crypto_box_seed_keypair() would
+ * compute for the corresponding seed, but the field inversions required
+ * to compute the public keys are shared within the batch.
+ */
+SODIUM_EXPORT
+int crypto_box_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                  const unsigned char *seeds, size_t n);
+
+SODIUM_EXPORT
+int crypto_box_keypair_batch(unsigned char *pks, unsigned char *sks, size_t n);
+
 SODIUM_EXPORT
 int crypto_box_easy(unsigned char *c, const unsigned char *m,
                     unsigned long long mlen, const unsigned char *n,
@@ -113,6 +127,48 @@ int crypto_box_open_detached_afternm(unsigned char *m, const unsigned char *c,
                                      const unsigned char *k)
             __attribute__ ((warn_unused_result));
 
+/* -- Shared key cache -- */
+
+/*
+ * A bounded, thread-safe cache of precomputed shared keys, indexed by
+ * (secret key, peer public key) and evicting the least recently used
+ * entries first. Secret keys are not stored in the cache, only shared
+ * keys, in memory allocated with sodium_malloc().
+ * The cache is split into 16 independently locked shards; capacity is
+ * rounded up to a multiple of the number of shards.
+ */
+typedef struct crypto_box_cache crypto_box_cache;
+
+SODIUM_EXPORT
+crypto_box_cache *crypto_box_cache_new(size_t capacity);
+
+SODIUM_EXPORT
+void crypto_box_cache_free(crypto_box_cache *cache);
+
+SODIUM_EXPORT
+int crypto_box_cache_beforenm(crypto_box_cache *cache, unsigned char *k,
+                              const unsigned char *pk, const unsigned char *sk)
+            __attribute__ ((warn_unused_result));
+
+SODIUM_EXPORT
+int crypto_box_easy_cached(crypto_box_cache *cache,
+                           unsigned char *c, const unsigned char *m,
+                           unsigned long long mlen, const unsigned char *n,
+                           const unsigned char *pk, const unsigned char *sk)
+            __attribute__ ((warn_unused_result));
+
+SODIUM_EXPORT
+int crypto_box_open_easy_cached(crypto_box_cache *cache,
+                                unsigned char *m, const unsigned char *c,
+                                unsigned long long clen, const unsigned char *n,
+                                const unsigned char *pk, const unsigned char *sk)
+            __attribute__ ((warn_unused_result));
+
+SODIUM_EXPORT
+void crypto_box_cache_stats(crypto_box_cache *cache,
+                            unsigned long long *hits,
+                            unsigned long long *misses);
+
 /* -- Ephemeral SK interface -- */
 
 #define crypto_box_SEALBYTES (crypto_box_PUBLICKEYBYTES + crypto_box_MACBYTES)
@@ -129,6 +185,60 @@ int crypto_box_seal_open(unsigned char *m, const unsigned char *c,
                          const unsigned char *pk, const unsigned char *sk)
             __attribute__ ((warn_unused_result));
 
+/*
+ * Multi-recipient sealed boxes: the message is encrypted once, and its key
+ * is sealed for each recipient. A ciphertext for n recipients is
+ * crypto_box_SEALMULTI_HEADERBYTES + n * crypto_box_SEALMULTI_SLOTBYTES +
+ * crypto_box_MACBYTES bytes longer than the message.
+ */
+#define crypto_box_SEALMULTI_HEADERBYTES (crypto_box_PUBLICKEYBYTES + 4U)
+SODIUM_EXPORT
+size_t crypto_box_sealmulti_headerbytes(void);
+
+#define crypto_box_SEALMULTI_SLOTBYTES \
+    (8U + crypto_box_BEFORENMBYTES + crypto_box_MACBYTES)
+SODIUM_EXPORT
+size_t crypto_box_sealmulti_slotbytes(void);
+
+SODIUM_EXPORT
+int crypto_box_seal_multi(unsigned char *c, const unsigned char *m,
+                          unsigned long long mlen,
+                          const unsigned char * const *pks, size_t npks);
+
+SODIUM_EXPORT
+int crypto_box_seal_multi_open(unsigned char *m, unsigned long long *mlen_p,
+                               const unsigned char *c, unsigned long long clen,
+                               const unsigned char *pk, const unsigned char *sk)
+            __attribute__ ((warn_unused_result));
+
+/*
+ * A bounded pool of single-use ephemeral key pairs, stored in memory
+ * allocated with sodium_malloc().
+ * crypto_box_seal_pool_refill() generates up to max_keys key pairs
+ * (0 = until the pool is full) and is meant to be called from idle time
+ * or from a dedicated thread. crypto_box_seal_pooled() takes one key pair
+ * out of the pool and wipes it, or generates one if the pool is empty.
+ */
+typedef struct crypto_box_seal_pool crypto_box_seal_pool;
+
+SODIUM_EXPORT
+crypto_box_seal_pool *crypto_box_seal_pool_new(size_t capacity);
+
+SODIUM_EXPORT
+void crypto_box_seal_pool_free(crypto_box_seal_pool *pool);
+
+SODIUM_EXPORT
+size_t crypto_box_seal_pool_refill(crypto_box_seal_pool *pool,
+                                   size_t max_keys);
+
+SODIUM_EXPORT
+size_t crypto_box_seal_pool_available(crypto_box_seal_pool *pool);
+
+SODIUM_EXPORT
+int crypto_box_seal_pooled(crypto_box_seal_pool *pool, unsigned char *c,
+                           const unsigned char *m, unsigned long long mlen,
+                           const unsigned char *pk);
+
 /* -- NaCl compatibility interface ; Requires padding -- */
 
 #define crypto_box_ZEROBYTES crypto_box_curve25519xsalsa20poly1305_ZEROBYTES
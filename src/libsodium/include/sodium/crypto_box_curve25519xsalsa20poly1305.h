@@ -72,6 +72,17 @@ SODIUM_EXPORT
 int crypto_box_curve25519xsalsa20poly1305_keypair(unsigned char *pk,
                                                   unsigned char *sk);
 
+SODIUM_EXPORT
+int crypto_box_curve25519xsalsa20poly1305_seed_keypair_batch(unsigned char *pks,
+                                                             unsigned char *sks,
+                                                             const unsigned char *seeds,
+                                                             size_t n);
+
+SODIUM_EXPORT
+int crypto_box_curve25519xsalsa20poly1305_keypair_batch(unsigned char *pks,
+                                                        unsigned char *sks,
+                                                        size_t n);
+
 SODIUM_EXPORT
 int crypto_box_curve25519xsalsa20poly1305_beforenm(unsigned char *k,
                                                    const unsigned char *pk,
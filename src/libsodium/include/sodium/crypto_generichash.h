@@ -64,6 +64,20 @@ SODIUM_EXPORT
 int crypto_generichash_final(crypto_generichash_state *state,
                              unsigned char *out, const size_t outlen);
 
+/*
+ * Hash everything from the current offset of fd to the end of the file, or
+ * the content of the file at path. Regular files are memory-mapped, and
+ * must not be truncated while being hashed.
+ */
+SODIUM_EXPORT
+int crypto_generichash_fd(unsigned char *out, size_t outlen, int fd,
+                          const unsigned char *key, size_t keylen);
+
+SODIUM_EXPORT
+int crypto_generichash_file(unsigned char *out, size_t outlen,
+                            const char *path,
+                            const unsigned char *key, size_t keylen);
+
 #ifdef __cplusplus
 }
 #endif
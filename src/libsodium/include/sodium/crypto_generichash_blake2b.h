@@ -85,6 +85,18 @@ int crypto_generichash_blake2b_salt_personal(unsigned char *out, size_t outlen,
                                              const unsigned char *salt,
                                              const unsigned char *personal);
 
+/*
+ * Hashes n independent messages, out[i] = H(in[i]), using several lanes of
+ * the CPU at once when possible. Faster than n separate calls on short
+ * messages.
+ */
+SODIUM_EXPORT
+int crypto_generichash_blake2b_multi(unsigned char * const *out, size_t outlen,
+                                     const unsigned char * const *in,
+                                     const unsigned long long *inlen,
+                                     const unsigned char *key, size_t keylen,
+                                     size_t n);
+
 SODIUM_EXPORT
 int crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
                                     const unsigned char *key,
@@ -107,6 +119,27 @@ int crypto_generichash_blake2b_final(crypto_generichash_blake2b_state *state,
                                      unsigned char *out,
                                      const size_t outlen);
 
+/*
+ * A prepared state has the key already absorbed. Copy it with
+ * crypto_generichash_blake2b_reset() before hashing each message, instead
+ * of initializing a new state with the same key.
+ */
+SODIUM_EXPORT
+int crypto_generichash_blake2b_keyed_prepare(crypto_generichash_blake2b_state *state,
+                                             const unsigned char *key,
+                                             const size_t keylen, const size_t outlen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2b_keyed_prepare_salt_personal(crypto_generichash_blake2b_state *state,
+                                                           const unsigned char *key,
+                                                           const size_t keylen, const size_t outlen,
+                                                           const unsigned char *salt,
+                                                           const unsigned char *personal);
+
+SODIUM_EXPORT
+void crypto_generichash_blake2b_reset(crypto_generichash_blake2b_state *state,
+                                      const crypto_generichash_blake2b_state *prepared);
+
 /* ------------------------------------------------------------------------- */
 
 int _crypto_generichash_blake2b_pick_best_implementation(void);
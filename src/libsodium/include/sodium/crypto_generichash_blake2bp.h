@@ -0,0 +1,103 @@
+#ifndef crypto_generichash_blake2bp_H
+#define crypto_generichash_blake2bp_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "crypto_generichash_blake2b.h"
+#include "export.h"
+
+#ifdef __cplusplus
+# ifdef __GNUC__
+#  pragma GCC diagnostic ignored "-Wlong-long"
+# endif
+extern "C" {
+#endif
+
+/*
+ * BLAKE2bp: the input is striped over 4 BLAKE2b leaves, 128 bytes at a
+ * time, and the leaf hashes are hashed by a root node. The leaves are
+ * independent, so they can be computed in parallel.
+ */
+
+typedef CRYPTO_ALIGN(64) struct crypto_generichash_blake2bp_state {
+    unsigned char opaque[2560];
+} crypto_generichash_blake2bp_state;
+
+#define crypto_generichash_blake2bp_BYTES_MIN     crypto_generichash_blake2b_BYTES_MIN
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_bytes_min(void);
+
+#define crypto_generichash_blake2bp_BYTES_MAX     crypto_generichash_blake2b_BYTES_MAX
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_bytes_max(void);
+
+#define crypto_generichash_blake2bp_BYTES         crypto_generichash_blake2b_BYTES
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_bytes(void);
+
+#define crypto_generichash_blake2bp_KEYBYTES_MIN  crypto_generichash_blake2b_KEYBYTES_MIN
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_keybytes_min(void);
+
+#define crypto_generichash_blake2bp_KEYBYTES_MAX  crypto_generichash_blake2b_KEYBYTES_MAX
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_keybytes_max(void);
+
+#define crypto_generichash_blake2bp_KEYBYTES      crypto_generichash_blake2b_KEYBYTES
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_keybytes(void);
+
+SODIUM_EXPORT
+size_t crypto_generichash_blake2bp_statebytes(void);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2bp(unsigned char *out, size_t outlen,
+                                const unsigned char *in,
+                                unsigned long long inlen,
+                                const unsigned char *key, size_t keylen);
+
+/*
+ * Same output as crypto_generichash_blake2bp(), with the leaves spread
+ * over up to `threads` threads (at most 4) for large inputs.
+ */
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_threaded(unsigned char *out, size_t outlen,
+                                         const unsigned char *in,
+                                         unsigned long long inlen,
+                                         const unsigned char *key,
+                                         size_t keylen, size_t threads);
+
+/* Same as crypto_generichash_fd() and crypto_generichash_file() */
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_fd(unsigned char *out, size_t outlen, int fd,
+                                   const unsigned char *key, size_t keylen,
+                                   size_t threads);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_file(unsigned char *out, size_t outlen,
+                                     const char *path,
+                                     const unsigned char *key, size_t keylen,
+                                     size_t threads);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_init(crypto_generichash_blake2bp_state *state,
+                                     const unsigned char *key,
+                                     const size_t keylen, const size_t outlen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_update(crypto_generichash_blake2bp_state *state,
+                                       const unsigned char *in,
+                                       unsigned long long inlen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2bp_final(crypto_generichash_blake2bp_state *state,
+                                      unsigned char *out,
+                                      const size_t outlen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef crypto_generichash_blake2s_H
+#define crypto_generichash_blake2s_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "export.h"
+
+#ifdef __cplusplus
+# ifdef __GNUC__
+#  pragma GCC diagnostic ignored "-Wlong-long"
+# endif
+extern "C" {
+#endif
+
+#if defined(__IBMC__) || defined(__SUNPRO_C) || defined(__SUNPRO_CC)
+# pragma pack(1)
+#else
+# pragma pack(push, 1)
+#endif
+
+typedef CRYPTO_ALIGN(64) struct crypto_generichash_blake2s_state {
+    uint32_t h[8];
+    uint32_t t[2];
+    uint32_t f[2];
+    uint8_t  buf[2 * 64];
+    size_t   buflen;
+    uint8_t  last_node;
+} crypto_generichash_blake2s_state;
+
+#if defined(__IBMC__) || defined(__SUNPRO_C) || defined(__SUNPRO_CC)
+# pragma pack()
+#else
+# pragma pack(pop)
+#endif
+
+#define crypto_generichash_blake2s_BYTES_MIN     16U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_bytes_min(void);
+
+#define crypto_generichash_blake2s_BYTES_MAX     32U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_bytes_max(void);
+
+#define crypto_generichash_blake2s_BYTES         32U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_bytes(void);
+
+#define crypto_generichash_blake2s_KEYBYTES_MIN  16U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_keybytes_min(void);
+
+#define crypto_generichash_blake2s_KEYBYTES_MAX  32U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_keybytes_max(void);
+
+#define crypto_generichash_blake2s_KEYBYTES      32U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_keybytes(void);
+
+#define crypto_generichash_blake2s_SALTBYTES     8U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_saltbytes(void);
+
+#define crypto_generichash_blake2s_PERSONALBYTES 8U
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_personalbytes(void);
+
+SODIUM_EXPORT
+size_t crypto_generichash_blake2s_statebytes(void);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s(unsigned char *out, size_t outlen,
+                               const unsigned char *in,
+                               unsigned long long inlen,
+                               const unsigned char *key, size_t keylen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s_salt_personal(unsigned char *out, size_t outlen,
+                                             const unsigned char *in,
+                                             unsigned long long inlen,
+                                             const unsigned char *key,
+                                             size_t keylen,
+                                             const unsigned char *salt,
+                                             const unsigned char *personal);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s_init(crypto_generichash_blake2s_state *state,
+                                    const unsigned char *key,
+                                    const size_t keylen, const size_t outlen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s_init_salt_personal(crypto_generichash_blake2s_state *state,
+                                                  const unsigned char *key,
+                                                  const size_t keylen, const size_t outlen,
+                                                  const unsigned char *salt,
+                                                  const unsigned char *personal);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s_update(crypto_generichash_blake2s_state *state,
+                                      const unsigned char *in,
+                                      unsigned long long inlen);
+
+SODIUM_EXPORT
+int crypto_generichash_blake2s_final(crypto_generichash_blake2s_state *state,
+                                     unsigned char *out,
+                                     const size_t outlen);
+
+/* ------------------------------------------------------------------------- */
+
+int _crypto_generichash_blake2s_pick_best_implementation(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
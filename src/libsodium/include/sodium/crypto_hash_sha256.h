@@ -49,6 +49,21 @@ SODIUM_EXPORT
 int crypto_hash_sha256_final(crypto_hash_sha256_state *state,
                              unsigned char *out);
 
+SODIUM_EXPORT
+int crypto_hash_sha256_multi(unsigned char *out,
+                             const unsigned char * const *in,
+                             const unsigned long long *inlen, size_t n);
+
+/* ------------------------------------------------------------------------- */
+
+int _crypto_hash_sha256_multi_from_state(unsigned char *out,
+                                         const unsigned char * const *in,
+                                         const unsigned long long *inlen,
+                                         size_t n,
+                                         const crypto_hash_sha256_state *state);
+
+int _crypto_hash_sha256_pick_best_implementation(void);
+
 #ifdef __cplusplus
 }
 #endif
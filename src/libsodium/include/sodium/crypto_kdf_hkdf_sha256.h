@@ -0,0 +1,72 @@
+#ifndef crypto_kdf_hkdf_sha256_H
+#define crypto_kdf_hkdf_sha256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crypto_auth_hmacsha256.h"
+#include "export.h"
+
+#ifdef __cplusplus
+# ifdef __GNUC__
+#  pragma GCC diagnostic ignored "-Wlong-long"
+# endif
+extern "C" {
+#endif
+
+#define crypto_kdf_hkdf_sha256_KEYBYTES crypto_auth_hmacsha256_BYTES
+SODIUM_EXPORT
+size_t crypto_kdf_hkdf_sha256_keybytes(void);
+
+#define crypto_kdf_hkdf_sha256_BYTES_MIN 0U
+SODIUM_EXPORT
+size_t crypto_kdf_hkdf_sha256_bytes_min(void);
+
+#define crypto_kdf_hkdf_sha256_BYTES_MAX (0xff * crypto_auth_hmacsha256_BYTES)
+SODIUM_EXPORT
+size_t crypto_kdf_hkdf_sha256_bytes_max(void);
+
+SODIUM_EXPORT
+int crypto_kdf_hkdf_sha256_extract(unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES],
+                                   const unsigned char *salt, size_t salt_len,
+                                   const unsigned char *ikm, size_t ikm_len);
+
+SODIUM_EXPORT
+void crypto_kdf_hkdf_sha256_keygen(unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES]);
+
+SODIUM_EXPORT
+int crypto_kdf_hkdf_sha256_expand(unsigned char *out, size_t out_len,
+                                  const char *ctx, size_t ctx_len,
+                                  const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES]);
+
+SODIUM_EXPORT
+int crypto_kdf_hkdf_sha256_expand_batch(unsigned char *out, size_t subkey_len,
+                                        const char * const *ctx,
+                                        const size_t *ctx_len, size_t n,
+                                        const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES]);
+
+/* ------------------------------------------------------------------------- */
+
+/*
+ * A PRK state holds the HMAC midstates of a PRK, so that every expand block
+ * only costs the inner and the outer compression.
+ */
+
+typedef crypto_auth_hmacsha256_keyed_state crypto_kdf_hkdf_sha256_prk_state;
+SODIUM_EXPORT
+size_t crypto_kdf_hkdf_sha256_prk_statebytes(void);
+
+SODIUM_EXPORT
+int crypto_kdf_hkdf_sha256_prk_init(crypto_kdf_hkdf_sha256_prk_state *state,
+                                    const unsigned char prk[crypto_kdf_hkdf_sha256_KEYBYTES]);
+
+SODIUM_EXPORT
+int crypto_kdf_hkdf_sha256_expand_from_state(unsigned char *out, size_t out_len,
+                                             const char *ctx, size_t ctx_len,
+                                             const crypto_kdf_hkdf_sha256_prk_state *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
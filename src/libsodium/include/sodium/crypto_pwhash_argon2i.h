@@ -75,6 +75,31 @@ int crypto_pwhash_argon2i_str_verify(const char str[crypto_pwhash_argon2i_STRBYT
                                      unsigned long long passwdlen)
             __attribute__ ((warn_unused_result));
 
+/*
+ * Variants using `parallelism` lanes, filled by up to 16 threads. The output
+ * depends on `parallelism`, which is stored in the string returned by
+ * crypto_pwhash_argon2i_str_parallel(). crypto_pwhash_argon2i_str_verify()
+ * uses the number of lanes of the string, and the same bounded number of
+ * threads.
+ */
+SODIUM_EXPORT
+int crypto_pwhash_argon2i_parallel(unsigned char * const out,
+                                   unsigned long long outlen,
+                                   const char * const passwd,
+                                   unsigned long long passwdlen,
+                                   const unsigned char * const salt,
+                                   unsigned long long opslimit, size_t memlimit,
+                                   size_t parallelism, int alg)
+            __attribute__ ((warn_unused_result));
+
+SODIUM_EXPORT
+int crypto_pwhash_argon2i_str_parallel(char out[crypto_pwhash_argon2i_STRBYTES],
+                                       const char * const passwd,
+                                       unsigned long long passwdlen,
+                                       unsigned long long opslimit,
+                                       size_t memlimit, size_t parallelism)
+            __attribute__ ((warn_unused_result));
+
 /* ------------------------------------------------------------------------- */
 
 int _crypto_pwhash_argon2i_pick_best_implementation(void);
@@ -25,6 +25,16 @@ int crypto_scalarmult_curve25519(unsigned char *q, const unsigned char *n,
 SODIUM_EXPORT
 int crypto_scalarmult_curve25519_base(unsigned char *q, const unsigned char *n);
 
+/*
+ * Computes count public keys from count consecutive scalars.
+ * q[32*i..32*i+31] is the same as crypto_scalarmult_curve25519_base()
+ * would compute for n[32*i..32*i+31].
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_curve25519_base_batch(unsigned char *q,
+                                            const unsigned char *n,
+                                            size_t count);
+
 /* ------------------------------------------------------------------------- */
 
 int _crypto_scalarmult_curve25519_pick_best_implementation(void);
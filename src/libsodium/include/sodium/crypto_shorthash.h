@@ -29,6 +29,50 @@ SODIUM_EXPORT
 int crypto_shorthash(unsigned char *out, const unsigned char *in,
                      unsigned long long inlen, const unsigned char *k);
 
+/* out receives n * crypto_shorthash_BYTES bytes */
+SODIUM_EXPORT
+int crypto_shorthash_batch(unsigned char *out, const unsigned char * const *in,
+                           const unsigned long long *inlen, size_t n,
+                           const unsigned char *k);
+
+/* -- Replay filter -- */
+
+/*
+ * A bounded set of recently seen messages, for rejecting replayed nonces or
+ * salts. Messages are hashed with SipHash-2-4 under a random secret key, so
+ * that collisions cannot be computed by an attacker. It uses blocked Bloom
+ * filters with one cache line per message. When a filter has received
+ * `capacity` messages, it becomes the previous filter and a new filter is
+ * started. A message is therefore remembered for at least `capacity`
+ * insertions. False positives occur at a rate below 0.2%. Memory usage is
+ * about 6 bytes per unit of capacity.
+ * crypto_shorthash_replay_check() does not take any lock, and can run
+ * concurrently with insertions. Messages whose insertion completed before the
+ * check started are reported, and messages being inserted may or may not be.
+ * A check that overlaps the start of a new filter may also miss messages that
+ * are about to be forgotten.
+ */
+typedef struct crypto_shorthash_replay crypto_shorthash_replay;
+
+SODIUM_EXPORT
+crypto_shorthash_replay *crypto_shorthash_replay_new(size_t capacity);
+
+SODIUM_EXPORT
+void crypto_shorthash_replay_free(crypto_shorthash_replay *filter);
+
+/* Returns 0 and adds the message if it has not been seen, -1 otherwise */
+SODIUM_EXPORT
+int crypto_shorthash_replay_check_insert(crypto_shorthash_replay *filter,
+                                         const unsigned char *in,
+                                         unsigned long long inlen)
+            __attribute__ ((warn_unused_result));
+
+/* Returns 1 if the message may have been seen, 0 otherwise */
+SODIUM_EXPORT
+int crypto_shorthash_replay_check(const crypto_shorthash_replay *filter,
+                                  const unsigned char *in,
+                                  unsigned long long inlen);
+
 #ifdef __cplusplus
 }
 #endif
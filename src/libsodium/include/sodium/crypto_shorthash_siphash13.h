@@ -0,0 +1,30 @@
+#ifndef crypto_shorthash_siphash13_H
+#define crypto_shorthash_siphash13_H
+
+#include <stddef.h>
+#include "export.h"
+
+#ifdef __cplusplus
+# ifdef __GNUC__
+#  pragma GCC diagnostic ignored "-Wlong-long"
+# endif
+extern "C" {
+#endif
+
+#define crypto_shorthash_siphash13_BYTES 8U
+SODIUM_EXPORT
+size_t crypto_shorthash_siphash13_bytes(void);
+
+#define crypto_shorthash_siphash13_KEYBYTES 16U
+SODIUM_EXPORT
+size_t crypto_shorthash_siphash13_keybytes(void);
+
+SODIUM_EXPORT
+int crypto_shorthash_siphash13(unsigned char *out, const unsigned char *in,
+                               unsigned long long inlen, const unsigned char *k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
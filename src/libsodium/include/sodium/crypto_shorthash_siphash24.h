@@ -23,6 +23,31 @@ SODIUM_EXPORT
 int crypto_shorthash_siphash24(unsigned char *out, const unsigned char *in,
                                unsigned long long inlen, const unsigned char *k);
 
+/* out receives n * crypto_shorthash_siphash24_BYTES bytes */
+SODIUM_EXPORT
+int crypto_shorthash_siphash24_batch(unsigned char *out,
+                                     const unsigned char * const *in,
+                                     const unsigned long long *inlen,
+                                     size_t n, const unsigned char *k);
+
+/* -- 128-bit output -- */
+
+#define crypto_shorthash_siphashx24_BYTES 16U
+SODIUM_EXPORT
+size_t crypto_shorthash_siphashx24_bytes(void);
+
+#define crypto_shorthash_siphashx24_KEYBYTES 16U
+SODIUM_EXPORT
+size_t crypto_shorthash_siphashx24_keybytes(void);
+
+SODIUM_EXPORT
+int crypto_shorthash_siphashx24(unsigned char *out, const unsigned char *in,
+                                unsigned long long inlen, const unsigned char *k);
+
+/* ------------------------------------------------------------------------- */
+
+int _crypto_shorthash_siphash24_pick_best_implementation(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,11 @@
 extern "C" {
 #endif
 
+typedef crypto_sign_ed25519ph_state crypto_sign_state;
+
+SODIUM_EXPORT
+size_t  crypto_sign_statebytes(void);
+
 #define crypto_sign_BYTES crypto_sign_ed25519_BYTES
 SODIUM_EXPORT
 size_t  crypto_sign_bytes(void);
@@ -47,6 +52,20 @@ int crypto_sign_seed_keypair(unsigned char *pk, unsigned char *sk,
 SODIUM_EXPORT
 int crypto_sign_keypair(unsigned char *pk, unsigned char *sk);
 
+/*
+ * Generate n key pairs at once. Public and secret keys are stored
+ * consecutively in pks and sks.
+ * Each key pair is the same as the one crypto_sign_seed_keypair() would
+ * compute for the corresponding seed, but public keys are encoded with a
+ * single field inversion per batch.
+ */
+SODIUM_EXPORT
+int crypto_sign_seed_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                   const unsigned char *seeds, size_t n);
+
+SODIUM_EXPORT
+int crypto_sign_keypair_batch(unsigned char *pks, unsigned char *sks, size_t n);
+
 SODIUM_EXPORT
 int crypto_sign(unsigned char *sm, unsigned long long *smlen_p,
                 const unsigned char *m, unsigned long long mlen,
@@ -70,6 +89,23 @@ int crypto_sign_verify_detached(const unsigned char *sig,
                                 const unsigned char *pk)
             __attribute__ ((warn_unused_result));
 
+SODIUM_EXPORT
+int crypto_sign_init(crypto_sign_state *state);
+
+SODIUM_EXPORT
+int crypto_sign_update(crypto_sign_state *state,
+                       const unsigned char *m, unsigned long long mlen);
+
+SODIUM_EXPORT
+int crypto_sign_final_create(crypto_sign_state *state, unsigned char *sig,
+                             unsigned long long *siglen_p,
+                             const unsigned char *sk);
+
+SODIUM_EXPORT
+int crypto_sign_final_verify(crypto_sign_state *state, const unsigned char *sig,
+                             const unsigned char *pk)
+            __attribute__ ((warn_unused_result));
+
 #ifdef __cplusplus
 }
 #endif
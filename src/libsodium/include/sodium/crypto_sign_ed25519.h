@@ -2,6 +2,7 @@
 #define crypto_sign_ed25519_H
 
 #include <stddef.h>
+#include "crypto_hash_sha512.h"
 #include "export.h"
 
 #ifdef __cplusplus
@@ -11,6 +12,13 @@
 extern "C" {
 #endif
 
+typedef struct crypto_sign_ed25519ph_state {
+    crypto_hash_sha512_state hs;
+} crypto_sign_ed25519ph_state;
+
+SODIUM_EXPORT
+size_t crypto_sign_ed25519ph_statebytes(void);
+
 #define crypto_sign_ed25519_BYTES 64U
 SODIUM_EXPORT
 size_t crypto_sign_ed25519_bytes(void);
@@ -27,6 +35,15 @@ size_t crypto_sign_ed25519_publickeybytes(void);
 SODIUM_EXPORT
 size_t crypto_sign_ed25519_secretkeybytes(void);
 
+typedef struct crypto_sign_ed25519_expandedsk {
+    unsigned char            az[64];
+    unsigned char            pk[32];
+    crypto_hash_sha512_state nonce_hs;
+} crypto_sign_ed25519_expandedsk;
+
+SODIUM_EXPORT
+size_t crypto_sign_ed25519_expandedskbytes(void);
+
 SODIUM_EXPORT
 int crypto_sign_ed25519(unsigned char *sm, unsigned long long *smlen_p,
                         const unsigned char *m, unsigned long long mlen,
@@ -45,6 +62,26 @@ int crypto_sign_ed25519_detached(unsigned char *sig,
                                  unsigned long long mlen,
                                  const unsigned char *sk);
 
+SODIUM_EXPORT
+int crypto_sign_ed25519_detached_expandedsk(unsigned char *sig,
+                                            unsigned long long *siglen_p,
+                                            const unsigned char *m,
+                                            unsigned long long mlen,
+                                            const crypto_sign_ed25519_expandedsk *esk);
+
+/*
+ * Signs msgs[0..n-1] with the same secret key, writing n consecutive
+ * crypto_sign_ed25519_BYTES signatures to sigs.
+ * Signatures are identical to the ones computed by
+ * crypto_sign_ed25519_detached(), but encoding the commitments of a
+ * batch only requires a single field inversion.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_detached_batch(unsigned char *sigs,
+                                       const unsigned char * const *msgs,
+                                       const unsigned long long *mlens,
+                                       size_t n, const unsigned char *sk);
+
 SODIUM_EXPORT
 int crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                         const unsigned char *m,
@@ -59,6 +96,16 @@ SODIUM_EXPORT
 int crypto_sign_ed25519_seed_keypair(unsigned char *pk, unsigned char *sk,
                                      const unsigned char *seed);
 
+SODIUM_EXPORT
+int crypto_sign_ed25519_seed_keypair_batch(unsigned char *pks,
+                                           unsigned char *sks,
+                                           const unsigned char *seeds,
+                                           size_t n);
+
+SODIUM_EXPORT
+int crypto_sign_ed25519_keypair_batch(unsigned char *pks, unsigned char *sks,
+                                      size_t n);
+
 SODIUM_EXPORT
 int crypto_sign_ed25519_pk_to_curve25519(unsigned char *curve25519_pk,
                                          const unsigned char *ed25519_pk)
@@ -75,6 +122,39 @@ int crypto_sign_ed25519_sk_to_seed(unsigned char *seed,
 SODIUM_EXPORT
 int crypto_sign_ed25519_sk_to_pk(unsigned char *pk, const unsigned char *sk);
 
+/*
+ * The expanded secret key holds the clamped scalar, the nonce prefix and
+ * a hash state already keyed with that prefix, so that signing many
+ * messages with the same key doesn't hash the seed every time.
+ * It is secret material: store it in memory from sodium_malloc() and
+ * clear it with sodium_memzero() or sodium_free() when no longer needed.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_sk_to_expandedsk(crypto_sign_ed25519_expandedsk *esk,
+                                         const unsigned char *sk);
+
+/* Ed25519ph (RFC 8032) - the message is hashed once, in a streaming fashion */
+
+SODIUM_EXPORT
+int crypto_sign_ed25519ph_init(crypto_sign_ed25519ph_state *state);
+
+SODIUM_EXPORT
+int crypto_sign_ed25519ph_update(crypto_sign_ed25519ph_state *state,
+                                 const unsigned char *m,
+                                 unsigned long long mlen);
+
+SODIUM_EXPORT
+int crypto_sign_ed25519ph_final_create(crypto_sign_ed25519ph_state *state,
+                                       unsigned char *sig,
+                                       unsigned long long *siglen_p,
+                                       const unsigned char *sk);
+
+SODIUM_EXPORT
+int crypto_sign_ed25519ph_final_verify(crypto_sign_ed25519ph_state *state,
+                                       const unsigned char *sig,
+                                       const unsigned char *pk)
+            __attribute__ ((warn_unused_result));
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,12 +5,18 @@
 #include <stdint.h>
 
 #define fe crypto_core_curve25519_ref10_fe
+#ifdef HAVE_TI_MODE
+typedef uint64_t fe[5];
+#else
 typedef int32_t fe[10];
+#endif
 
 /*
  fe means field element.
  Here the field is \Z/(2^255-19).
- An element t, entries t[0]...t[9], represents the integer
+ With 128-bit arithmetic available, an element t, entries t[0]...t[4],
+ represents the integer t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+ Otherwise, an element t, entries t[0]...t[9], represents the integer
  t[0]+2^26 t[1]+2^51 t[2]+2^77 t[3]+2^102 t[4]+...+2^230 t[9].
  Bounds on each t[i] vary depending on context.
  */
@@ -30,6 +36,7 @@ typedef int32_t fe[10];
 #define fe_sq crypto_core_curve25519_ref10_fe_sq
 #define fe_sq2 crypto_core_curve25519_ref10_fe_sq2
 #define fe_invert crypto_core_curve25519_ref10_fe_invert
+#define fe_batch_invert crypto_core_curve25519_ref10_fe_batch_invert
 #define fe_pow22523 crypto_core_curve25519_ref10_fe_pow22523
 
 extern void fe_frombytes(fe,const unsigned char *);
@@ -48,6 +55,7 @@ extern void fe_mul(fe,const fe,const fe);
 extern void fe_sq(fe,const fe);
 extern void fe_sq2(fe,const fe);
 extern void fe_invert(fe,const fe);
+extern void fe_batch_invert(fe *,const fe *,size_t);
 extern void fe_pow22523(fe,const fe);
 
 /*
@@ -105,6 +113,7 @@ typedef struct {
 #define ge_frombytes_negate_vartime crypto_core_curve25519_ref10_ge_frombytes_negate_vartime
 #define ge_tobytes crypto_core_curve25519_ref10_ge_tobytes
 #define ge_p3_tobytes crypto_core_curve25519_ref10_ge_p3_tobytes
+#define ge_p3_batch_tobytes crypto_core_curve25519_ref10_ge_p3_batch_tobytes
 
 #define ge_p2_0 crypto_core_curve25519_ref10_ge_p2_0
 #define ge_p3_0 crypto_core_curve25519_ref10_ge_p3_0
@@ -126,6 +135,7 @@ typedef struct {
 
 extern void ge_tobytes(unsigned char *,const ge_p2 *);
 extern void ge_p3_tobytes(unsigned char *,const ge_p3 *);
+extern void ge_p3_batch_tobytes(unsigned char *,fe *,const ge_p3 *,size_t);
 extern int ge_frombytes_negate_vartime(ge_p3 *,const unsigned char *);
 
 extern void ge_p2_0(ge_p2 *);
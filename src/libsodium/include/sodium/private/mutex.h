@@ -1,7 +1,22 @@
 #ifndef mutex_H
 #define mutex_H 1
 
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+# include <pthread.h>
+typedef pthread_mutex_t sodium_mutex_t;
+#elif defined(_WIN32)
+# include <windows.h>
+typedef CRITICAL_SECTION sodium_mutex_t;
+#else
+typedef volatile int sodium_mutex_t;
+#endif
+
 extern int sodium_crit_enter(void);
 extern int sodium_crit_leave(void);
 
+extern int sodium_mutex_init(sodium_mutex_t *mutex);
+extern int sodium_mutex_destroy(sodium_mutex_t *mutex);
+extern int sodium_mutex_lock(sodium_mutex_t *mutex);
+extern int sodium_mutex_unlock(sodium_mutex_t *mutex);
+
 #endif
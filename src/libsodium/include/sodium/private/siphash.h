@@ -0,0 +1,32 @@
+#ifndef siphash_H
+#define siphash_H
+
+#include <stdint.h>
+
+#define SIPHASH_ROTL(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIPROUND                                                       \
+    do {                                                               \
+        v0 += v1; v1 = SIPHASH_ROTL(v1, 13); v1 ^= v0; v0 = SIPHASH_ROTL(v0, 32); \
+        v2 += v3; v3 = SIPHASH_ROTL(v3, 16); v3 ^= v2;                 \
+        v0 += v3; v3 = SIPHASH_ROTL(v3, 21); v3 ^= v0;                 \
+        v2 += v1; v1 = SIPHASH_ROTL(v1, 17); v1 ^= v2; v2 = SIPHASH_ROTL(v2, 32); \
+    } while (0)
+
+/* Loads the last (inlen % 8) bytes of the input, and the length byte */
+#define SIPHASH_LAST_WORD(b, in, inlen)                                \
+    do {                                                               \
+        b = ((uint64_t) (inlen)) << 56;                                \
+        switch ((inlen) & 7) {                                         \
+        case 7: b |= ((uint64_t) (in)[6]) << 48;                       \
+        case 6: b |= ((uint64_t) (in)[5]) << 40;                       \
+        case 5: b |= ((uint64_t) (in)[4]) << 32;                       \
+        case 4: b |= ((uint64_t) (in)[3]) << 24;                       \
+        case 3: b |= ((uint64_t) (in)[2]) << 16;                       \
+        case 2: b |= ((uint64_t) (in)[1]) << 8;                        \
+        case 1: b |= ((uint64_t) (in)[0]); break;                      \
+        case 0: break;                                                 \
+        }                                                              \
+    } while (0)
+
+#endif
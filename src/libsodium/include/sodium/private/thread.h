@@ -0,0 +1,52 @@
+#ifndef thread_H
+#define thread_H 1
+
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+# include <pthread.h>
+#elif defined(_WIN32)
+# include <windows.h>
+#endif
+
+typedef struct sodium_thread_t {
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+    pthread_t handle;
+#elif defined(_WIN32)
+    HANDLE    handle;
+#endif
+    void    (*fn)(void *);
+    void     *arg;
+} sodium_thread_t;
+
+/*
+ * sodium_thread_create() returns -1 if threads are not available; callers
+ * are expected to run fn(arg) themselves in that case.
+ */
+extern int sodium_thread_create(sodium_thread_t *thread,
+                                void (*fn)(void *), void *arg);
+extern int sodium_thread_join(sodium_thread_t *thread);
+
+typedef struct sodium_barrier_t {
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+    pthread_mutex_t    mutex;
+    pthread_cond_t     cond;
+#elif defined(_WIN32)
+    CRITICAL_SECTION   mutex;
+    CONDITION_VARIABLE cond;
+#endif
+    unsigned int       count;
+    unsigned int       waiting;
+    unsigned int       generation;
+} sodium_barrier_t;
+
+/*
+ * sodium_barrier_wait() blocks until `count` threads are waiting.
+ * sodium_barrier_leave() permanently removes a thread that will never wait,
+ * for example because it could not be started. Without threads, a barrier
+ * can only be used by a single thread.
+ */
+extern int sodium_barrier_init(sodium_barrier_t *barrier, unsigned int count);
+extern int sodium_barrier_destroy(sodium_barrier_t *barrier);
+extern int sodium_barrier_wait(sodium_barrier_t *barrier);
+extern int sodium_barrier_leave(sodium_barrier_t *barrier);
+
+#endif
@@ -29,12 +29,18 @@ int sodium_runtime_has_avx(void);
 SODIUM_EXPORT
 int sodium_runtime_has_avx2(void);
 
+SODIUM_EXPORT
+int sodium_runtime_has_bmi2(void);
+
 SODIUM_EXPORT
 int sodium_runtime_has_pclmul(void);
 
 SODIUM_EXPORT
 int sodium_runtime_has_aesni(void);
 
+SODIUM_EXPORT
+int sodium_runtime_has_shani(void);
+
 /* ------------------------------------------------------------------------- */
 
 int _sodium_runtime_get_cpu_features(void);
@@ -9,14 +9,19 @@
 
 #include "core.h"
 #include "crypto_generichash.h"
+#include "crypto_generichash_blake2s.h"
+#include "crypto_hash_sha256.h"
+#include "crypto_hash_sha512.h"
 #include "crypto_onetimeauth.h"
 #include "crypto_pwhash_argon2i.h"
 #include "crypto_scalarmult.h"
+#include "crypto_shorthash_siphash24.h"
 #include "crypto_stream_chacha20.h"
 #include "randombytes.h"
 #include "runtime.h"
 #include "utils.h"
 #include "private/mutex.h"
+#include "private/thread.h"
 
 #if !defined(_MSC_VER) && 1
 # warning *** This is unstable, untested, development code.
@@ -52,8 +57,12 @@ sodium_init(void)
     _sodium_alloc_init();
     _crypto_pwhash_argon2i_pick_best_implementation();
     _crypto_generichash_blake2b_pick_best_implementation();
+    _crypto_generichash_blake2s_pick_best_implementation();
+    _crypto_hash_sha256_pick_best_implementation();
+    _crypto_hash_sha512_pick_best_implementation();
     _crypto_onetimeauth_poly1305_pick_best_implementation();
     _crypto_scalarmult_curve25519_pick_best_implementation();
+    _crypto_shorthash_siphash24_pick_best_implementation();
     _crypto_stream_chacha20_pick_best_implementation();
     initialized = 1;
     if (sodium_crit_leave() != 0) {
@@ -78,6 +87,30 @@ sodium_crit_leave(void)
     return pthread_mutex_unlock(&_sodium_lock);
 }
 
+int
+sodium_mutex_init(sodium_mutex_t *mutex)
+{
+    return pthread_mutex_init(mutex, NULL);
+}
+
+int
+sodium_mutex_destroy(sodium_mutex_t *mutex)
+{
+    return pthread_mutex_destroy(mutex);
+}
+
+int
+sodium_mutex_lock(sodium_mutex_t *mutex)
+{
+    return pthread_mutex_lock(mutex);
+}
+
+int
+sodium_mutex_unlock(sodium_mutex_t *mutex)
+{
+    return pthread_mutex_unlock(mutex);
+}
+
 #elif defined(_WIN32)
 
 static CRITICAL_SECTION _sodium_lock;
@@ -123,18 +156,66 @@ sodium_crit_leave(void)
     return 0;
 }
 
+int
+sodium_mutex_init(sodium_mutex_t *mutex)
+{
+    InitializeCriticalSection(mutex);
+
+    return 0;
+}
+
+int
+sodium_mutex_destroy(sodium_mutex_t *mutex)
+{
+    DeleteCriticalSection(mutex);
+
+    return 0;
+}
+
+int
+sodium_mutex_lock(sodium_mutex_t *mutex)
+{
+    EnterCriticalSection(mutex);
+
+    return 0;
+}
+
+int
+sodium_mutex_unlock(sodium_mutex_t *mutex)
+{
+    LeaveCriticalSection(mutex);
+
+    return 0;
+}
+
 #elif defined(HAVE_ATOMIC_OPS) && !defined(__EMSCRIPTEN__) && !defined(__native_client__)
 
-static volatile int _sodium_lock;
+static sodium_mutex_t _sodium_lock;
 
 int
-sodium_crit_enter(void)
+sodium_mutex_init(sodium_mutex_t *mutex)
+{
+    *mutex = 0;
+
+    return 0;
+}
+
+int
+sodium_mutex_destroy(sodium_mutex_t *mutex)
+{
+    (void) mutex;
+
+    return 0;
+}
+
+int
+sodium_mutex_lock(sodium_mutex_t *mutex)
 {
 # ifdef HAVE_NANOSLEEP
     struct timespec q;
     memset(&q, 0, sizeof q);
 # endif
-    while (__sync_lock_test_and_set(&_sodium_lock, 1) != 0) {
+    while (__sync_lock_test_and_set(mutex, 1) != 0) {
 # ifdef HAVE_NANOSLEEP
         (void) nanosleep(&q, NULL);
 # elif defined(__x86_64__) || defined(__i386__)
@@ -145,13 +226,25 @@ sodium_crit_enter(void)
 }
 
 int
-sodium_crit_leave(void)
+sodium_mutex_unlock(sodium_mutex_t *mutex)
 {
-    __sync_lock_release(&_sodium_lock);
+    __sync_lock_release(mutex);
 
     return 0;
 }
 
+int
+sodium_crit_enter(void)
+{
+    return sodium_mutex_lock(&_sodium_lock);
+}
+
+int
+sodium_crit_leave(void)
+{
+    return sodium_mutex_unlock(&_sodium_lock);
+}
+
 #else
 
 int
@@ -166,4 +259,294 @@ sodium_crit_leave(void)
     return 0;
 }
 
+int
+sodium_mutex_init(sodium_mutex_t *mutex)
+{
+    (void) mutex;
+
+    return 0;
+}
+
+int
+sodium_mutex_destroy(sodium_mutex_t *mutex)
+{
+    (void) mutex;
+
+    return 0;
+}
+
+int
+sodium_mutex_lock(sodium_mutex_t *mutex)
+{
+    (void) mutex;
+
+    return 0;
+}
+
+int
+sodium_mutex_unlock(sodium_mutex_t *mutex)
+{
+    (void) mutex;
+
+    return 0;
+}
+
+#endif
+
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+
+static void *
+_sodium_thread_start(void *thread_)
+{
+    sodium_thread_t *thread = (sodium_thread_t *) thread_;
+
+    thread->fn(thread->arg);
+
+    return NULL;
+}
+
+int
+sodium_thread_create(sodium_thread_t *thread, void (*fn)(void *), void *arg)
+{
+    thread->fn = fn;
+    thread->arg = arg;
+    if (pthread_create(&thread->handle, NULL, _sodium_thread_start,
+                       thread) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+int
+sodium_thread_join(sodium_thread_t *thread)
+{
+    return pthread_join(thread->handle, NULL) == 0 ? 0 : -1;
+}
+
+int
+sodium_barrier_init(sodium_barrier_t *barrier, unsigned int count)
+{
+    if (count == 0U) {
+        return -1;
+    }
+    barrier->count = count;
+    barrier->waiting = 0U;
+    barrier->generation = 0U;
+    if (pthread_mutex_init(&barrier->mutex, NULL) != 0) {
+        return -1;
+    }
+    if (pthread_cond_init(&barrier->cond, NULL) != 0) {
+        pthread_mutex_destroy(&barrier->mutex);
+        return -1;
+    }
+    return 0;
+}
+
+int
+sodium_barrier_destroy(sodium_barrier_t *barrier)
+{
+    pthread_cond_destroy(&barrier->cond);
+
+    return pthread_mutex_destroy(&barrier->mutex) == 0 ? 0 : -1;
+}
+
+static void
+_sodium_barrier_release(sodium_barrier_t *barrier)
+{
+    if (barrier->waiting >= barrier->count && barrier->waiting > 0U) {
+        barrier->waiting = 0U;
+        barrier->generation++;
+        pthread_cond_broadcast(&barrier->cond);
+    }
+}
+
+int
+sodium_barrier_wait(sodium_barrier_t *barrier)
+{
+    unsigned int generation;
+
+    if (pthread_mutex_lock(&barrier->mutex) != 0) {
+        return -1;
+    }
+    generation = barrier->generation;
+    barrier->waiting++;
+    _sodium_barrier_release(barrier);
+    while (generation == barrier->generation) {
+        pthread_cond_wait(&barrier->cond, &barrier->mutex);
+    }
+    return pthread_mutex_unlock(&barrier->mutex) == 0 ? 0 : -1;
+}
+
+int
+sodium_barrier_leave(sodium_barrier_t *barrier)
+{
+    if (pthread_mutex_lock(&barrier->mutex) != 0) {
+        return -1;
+    }
+    if (barrier->count > 0U) {
+        barrier->count--;
+    }
+    _sodium_barrier_release(barrier);
+
+    return pthread_mutex_unlock(&barrier->mutex) == 0 ? 0 : -1;
+}
+
+#elif defined(_WIN32)
+
+static DWORD WINAPI
+_sodium_thread_start(LPVOID thread_)
+{
+    sodium_thread_t *thread = (sodium_thread_t *) thread_;
+
+    thread->fn(thread->arg);
+
+    return 0;
+}
+
+int
+sodium_thread_create(sodium_thread_t *thread, void (*fn)(void *), void *arg)
+{
+    thread->fn = fn;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, _sodium_thread_start, thread,
+                                  0, NULL);
+
+    return thread->handle == NULL ? -1 : 0;
+}
+
+int
+sodium_thread_join(sodium_thread_t *thread)
+{
+    DWORD status;
+
+    status = WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+
+    return status == WAIT_OBJECT_0 ? 0 : -1;
+}
+
+int
+sodium_barrier_init(sodium_barrier_t *barrier, unsigned int count)
+{
+    if (count == 0U) {
+        return -1;
+    }
+    barrier->count = count;
+    barrier->waiting = 0U;
+    barrier->generation = 0U;
+    InitializeCriticalSection(&barrier->mutex);
+    InitializeConditionVariable(&barrier->cond);
+
+    return 0;
+}
+
+int
+sodium_barrier_destroy(sodium_barrier_t *barrier)
+{
+    DeleteCriticalSection(&barrier->mutex);
+
+    return 0;
+}
+
+static void
+_sodium_barrier_release(sodium_barrier_t *barrier)
+{
+    if (barrier->waiting >= barrier->count && barrier->waiting > 0U) {
+        barrier->waiting = 0U;
+        barrier->generation++;
+        WakeAllConditionVariable(&barrier->cond);
+    }
+}
+
+int
+sodium_barrier_wait(sodium_barrier_t *barrier)
+{
+    unsigned int generation;
+
+    EnterCriticalSection(&barrier->mutex);
+    generation = barrier->generation;
+    barrier->waiting++;
+    _sodium_barrier_release(barrier);
+    while (generation == barrier->generation) {
+        SleepConditionVariableCS(&barrier->cond, &barrier->mutex, INFINITE);
+    }
+    LeaveCriticalSection(&barrier->mutex);
+
+    return 0;
+}
+
+int
+sodium_barrier_leave(sodium_barrier_t *barrier)
+{
+    EnterCriticalSection(&barrier->mutex);
+    if (barrier->count > 0U) {
+        barrier->count--;
+    }
+    _sodium_barrier_release(barrier);
+    LeaveCriticalSection(&barrier->mutex);
+
+    return 0;
+}
+
+#else
+
+int
+sodium_thread_create(sodium_thread_t *thread, void (*fn)(void *), void *arg)
+{
+    (void) thread;
+    (void) fn;
+    (void) arg;
+
+    return -1;
+}
+
+int
+sodium_thread_join(sodium_thread_t *thread)
+{
+    (void) thread;
+
+    return -1;
+}
+
+int
+sodium_barrier_init(sodium_barrier_t *barrier, unsigned int count)
+{
+    if (count == 0U) {
+        return -1;
+    }
+    barrier->count = count;
+    barrier->waiting = 0U;
+    barrier->generation = 0U;
+
+    return 0;
+}
+
+int
+sodium_barrier_destroy(sodium_barrier_t *barrier)
+{
+    (void) barrier;
+
+    return 0;
+}
+
+int
+sodium_barrier_wait(sodium_barrier_t *barrier)
+{
+    if (barrier->count > 1U) {
+        return -1;
+    }
+    barrier->generation++;
+
+    return 0;
+}
+
+int
+sodium_barrier_leave(sodium_barrier_t *barrier)
+{
+    if (barrier->count > 0U) {
+        barrier->count--;
+    }
+    return 0;
+}
+
 #endif
@@ -16,13 +16,17 @@ typedef struct CPUFeatures_ {
     int has_sse41;
     int has_avx;
     int has_avx2;
+    int has_bmi2;
     int has_pclmul;
     int has_aesni;
+    int has_shani;
 } CPUFeatures;
 
 static CPUFeatures _cpu_features;
 
 #define CPUID_EBX_AVX2    0x00000020
+#define CPUID_EBX_BMI2    0x00000100
+#define CPUID_EBX_SHA     0x20000000
 
 #define CPUID_ECX_SSE3    0x00000001
 #define CPUID_ECX_PCLMUL  0x00000002
@@ -165,6 +169,7 @@ _sodium_runtime_intel_cpu_features(CPUFeatures * const cpu_features)
 #endif
 
     cpu_features->has_avx2 = 0;
+    cpu_features->has_bmi2 = 0;
 #if defined(HAVE_AVX2INTRIN_H) || \
     (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)))
     if (cpu_features->has_avx) {
@@ -172,6 +177,7 @@ _sodium_runtime_intel_cpu_features(CPUFeatures * const cpu_features)
 
         _cpuid(cpu_info7, 0x00000007);
         cpu_features->has_avx2 = ((cpu_info7[1] & CPUID_EBX_AVX2) != 0x0);
+        cpu_features->has_bmi2 = ((cpu_info7[1] & CPUID_EBX_BMI2) != 0x0);
     }
 #endif
 
@@ -184,6 +190,17 @@ _sodium_runtime_intel_cpu_features(CPUFeatures * const cpu_features)
     cpu_features->has_aesni = 0;
 #endif
 
+    cpu_features->has_shani = 0;
+#if defined(HAVE_SHAINTRIN_H) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1900 && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)))
+    if (id >= 0x00000007 && cpu_features->has_sse41) {
+        unsigned int cpu_info7[4];
+
+        _cpuid(cpu_info7, 0x00000007);
+        cpu_features->has_shani = ((cpu_info7[1] & CPUID_EBX_SHA) != 0x0);
+    }
+#endif
+
     return 0;
 }
 
@@ -234,6 +251,11 @@ sodium_runtime_has_avx2(void) {
     return _cpu_features.has_avx2;
 }
 
+int
+sodium_runtime_has_bmi2(void) {
+    return _cpu_features.has_bmi2;
+}
+
 int
 sodium_runtime_has_pclmul(void) {
     return _cpu_features.has_pclmul;
@@ -243,3 +265,8 @@ int
 sodium_runtime_has_aesni(void) {
     return _cpu_features.has_aesni;
 }
+
+int
+sodium_runtime_has_shani(void) {
+    return _cpu_features.has_shani;
+}
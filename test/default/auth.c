@@ -12,6 +12,94 @@ static unsigned char key2[] = "Another one got caught today, it's all over the p
 static unsigned char a[crypto_auth_BYTES];
 static unsigned char a2[crypto_auth_hmacsha512_BYTES];
 
+static void
+tv_keyed(void)
+{
+    crypto_auth_hmacsha256_keyed_state    kst256;
+    crypto_auth_hmacsha512_keyed_state    kst512;
+    crypto_auth_hmacsha512256_keyed_state kst512256;
+    crypto_auth_hmacsha256_state          st256;
+    unsigned char                         t1[crypto_auth_hmacsha512_BYTES];
+    unsigned char                         t2[crypto_auth_hmacsha512_BYTES];
+
+    crypto_auth_hmacsha256_keyed_init(&kst256, key2, sizeof key2);
+    crypto_auth_hmacsha256_keyed(t1, c, sizeof c - 1U, &kst256);
+    crypto_auth_hmacsha256_init(&st256, key2, sizeof key2);
+    crypto_auth_hmacsha256_update(&st256, c, sizeof c - 1U);
+    crypto_auth_hmacsha256_final(&st256, t2);
+    printf("%d ", memcmp(t1, t2, crypto_auth_hmacsha256_BYTES));
+    crypto_auth_hmacsha256_keyed_start(&st256, &kst256);
+    crypto_auth_hmacsha256_update(&st256, c, 1U);
+    crypto_auth_hmacsha256_update(&st256, c + 1U, sizeof c - 2U);
+    crypto_auth_hmacsha256_final(&st256, t2);
+    printf("%d ", memcmp(t1, t2, crypto_auth_hmacsha256_BYTES));
+    printf("%d ", crypto_auth_hmacsha256_keyed_verify(t1, c, sizeof c - 1U,
+                                                      &kst256));
+    t1[0]++;
+    printf("%d\n", crypto_auth_hmacsha256_keyed_verify(t1, c, sizeof c - 1U,
+                                                        &kst256));
+
+    crypto_auth_hmacsha512_keyed_init(&kst512, key, crypto_auth_hmacsha512_KEYBYTES);
+    crypto_auth_hmacsha512_keyed(t1, c, sizeof c - 1U, &kst512);
+    crypto_auth_hmacsha512(t2, c, sizeof c - 1U, key);
+    printf("%d ", memcmp(t1, t2, crypto_auth_hmacsha512_BYTES));
+    printf("%d ", crypto_auth_hmacsha512_keyed_verify(t1, c, sizeof c - 1U,
+                                                      &kst512));
+    t1[63]++;
+    printf("%d\n", crypto_auth_hmacsha512_keyed_verify(t1, c, sizeof c - 1U,
+                                                        &kst512));
+
+    crypto_auth_hmacsha512256_keyed_init(&kst512256, key, crypto_auth_KEYBYTES);
+    crypto_auth_hmacsha512256_keyed(t1, c, sizeof c - 1U, &kst512256);
+    crypto_auth(t2, c, sizeof c - 1U, key);
+    printf("%d ", memcmp(t1, t2, crypto_auth_BYTES));
+    printf("%d ", crypto_auth_hmacsha512256_keyed_verify(t1, c, sizeof c - 1U,
+                                                         &kst512256));
+    t1[31]++;
+    printf("%d\n", crypto_auth_hmacsha512256_keyed_verify(t1, c, sizeof c - 1U,
+                                                           &kst512256));
+
+    assert(crypto_auth_hmacsha256_keyed_statebytes() == sizeof kst256);
+    assert(crypto_auth_hmacsha512_keyed_statebytes() == sizeof kst512);
+    assert(crypto_auth_hmacsha512256_keyed_statebytes() == sizeof kst512256);
+}
+
+static void
+tv_multi(void)
+{
+    unsigned char       *msgs;
+    unsigned char       *tags;
+    const unsigned char *in[70];
+    unsigned long long   inlen[70];
+    size_t               i;
+
+    msgs = (unsigned char *) sodium_malloc(70 * 300);
+    tags = (unsigned char *) sodium_malloc(70 * crypto_auth_hmacsha512_BYTES);
+    randombytes_buf(msgs, 70 * 300);
+    for (i = 0; i < 70; i++) {
+        in[i] = &msgs[i * 300];
+        inlen[i] = (i * 41) % 300;
+    }
+    crypto_auth_hmacsha512_multi(tags, in, inlen, 70, key);
+    for (i = 0; i < 70; i++) {
+        if (crypto_auth_hmacsha512_verify(&tags[i * crypto_auth_hmacsha512_BYTES],
+                                          in[i], inlen[i], key) != 0) {
+            printf("hmacsha512_multi: verification failed for message %u\n",
+                   (unsigned int) i);
+        }
+    }
+    crypto_auth_hmacsha512256_multi(tags, in, inlen, 70, key);
+    for (i = 0; i < 70; i++) {
+        if (crypto_auth_verify(&tags[i * crypto_auth_BYTES],
+                               in[i], inlen[i], key) != 0) {
+            printf("hmacsha512256_multi: verification failed for message %u\n",
+                   (unsigned int) i);
+        }
+    }
+    sodium_free(tags);
+    sodium_free(msgs);
+}
+
 int main(void)
 {
     crypto_auth_hmacsha512_state st;
@@ -48,6 +136,11 @@ int main(void)
             printf("\n");
     }
 
+    printf("\n");
+
+    tv_keyed();
+    tv_multi();
+
     assert(crypto_auth_bytes() > 0U);
     assert(crypto_auth_keybytes() > 0U);
     assert(strcmp(crypto_auth_primitive(), "hmacsha512256") == 0);
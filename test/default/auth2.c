@@ -19,7 +19,11 @@ static unsigned char a[32];
 
 int main(void)
 {
-    int i;
+    unsigned char       *msgs;
+    unsigned char       *tags;
+    const unsigned char *in[50];
+    unsigned long long   inlen[50];
+    int                  i;
 
     crypto_auth_hmacsha256(a, c, sizeof c, key);
     for (i = 0; i < 32; ++i) {
@@ -27,5 +31,26 @@ int main(void)
         if (i % 8 == 7)
             printf("\n");
     }
+
+    msgs = (unsigned char *) sodium_malloc(50 * 200);
+    tags = (unsigned char *) sodium_malloc(50 * crypto_auth_hmacsha256_BYTES);
+    randombytes_buf(msgs, 50 * 200);
+    for (i = 0; i < 50; i++) {
+        in[i] = &msgs[i * 200];
+        inlen[i] = (unsigned long long) (i * 4);
+    }
+    in[49] = c;
+    inlen[49] = sizeof c;
+    crypto_auth_hmacsha256_multi(tags, in, inlen, 50, key);
+    for (i = 0; i < 50; i++) {
+        if (crypto_auth_hmacsha256_verify(&tags[i * crypto_auth_hmacsha256_BYTES],
+                                          in[i], inlen[i], key) != 0) {
+            printf("multi: verification failed for message %d\n", i);
+        }
+    }
+    printf("%d\n", memcmp(&tags[49 * crypto_auth_hmacsha256_BYTES], a, sizeof a));
+    sodium_free(tags);
+    sodium_free(msgs);
+
     return 0;
 }
@@ -0,0 +1,96 @@
+
+#define TEST_NAME "box_cache"
+#include "cmptest.h"
+
+static const unsigned char small_order_p[crypto_box_PUBLICKEYBYTES]
+    = { 0xe0, 0xeb, 0x7a, 0x7c, 0x3b, 0x41, 0xb8, 0xae, 0x16, 0x56, 0xe3,
+        0xfa, 0xf1, 0x9f, 0xc4, 0x6a, 0xda, 0x09, 0x8d, 0xeb, 0x9c, 0x32,
+        0xb1, 0xfd, 0x86, 0x62, 0x05, 0x16, 0x5f, 0x49, 0xb8, 0x00 };
+
+int main(void)
+{
+    crypto_box_cache  *cache;
+    unsigned char      alicepk[crypto_box_PUBLICKEYBYTES];
+    unsigned char      alicesk[crypto_box_SECRETKEYBYTES];
+    unsigned char      bobpk[crypto_box_PUBLICKEYBYTES];
+    unsigned char      bobsk[crypto_box_SECRETKEYBYTES];
+    unsigned char      peerpks[100 * crypto_box_PUBLICKEYBYTES];
+    unsigned char      peersks[100 * crypto_box_SECRETKEYBYTES];
+    unsigned char      k1[crypto_box_BEFORENMBYTES];
+    unsigned char      k2[crypto_box_BEFORENMBYTES];
+    unsigned char      nonce[crypto_box_NONCEBYTES];
+    unsigned char      m[100];
+    unsigned char      m2[100];
+    unsigned char      c[crypto_box_MACBYTES + 100];
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned int       i;
+    unsigned int       j;
+
+    assert(crypto_box_cache_new(0U) == NULL);
+    cache = crypto_box_cache_new(1000U);
+    assert(cache != NULL);
+
+    crypto_box_keypair(alicepk, alicesk);
+    crypto_box_keypair(bobpk, bobsk);
+    randombytes_buf(nonce, sizeof nonce);
+    randombytes_buf(m, sizeof m);
+
+    for (i = 0U; i < 2U; i++) {
+        if (crypto_box_easy_cached(cache, c, m, sizeof m, nonce,
+                                   bobpk, alicesk) != 0) {
+            printf("crypto_box_easy_cached() failed\n");
+        }
+        if (crypto_box_open_easy(m2, c, sizeof c, nonce, alicepk, bobsk) != 0 ||
+            memcmp(m, m2, sizeof m) != 0) {
+            printf("crypto_box_open_easy() failed\n");
+        }
+        memset(m2, 0, sizeof m2);
+        if (crypto_box_open_easy_cached(cache, m2, c, sizeof c, nonce,
+                                        alicepk, bobsk) != 0 ||
+            memcmp(m, m2, sizeof m) != 0) {
+            printf("crypto_box_open_easy_cached() failed\n");
+        }
+    }
+    c[0] ^= 1;
+    printf("%d\n", crypto_box_open_easy_cached(cache, m2, c, sizeof c, nonce,
+                                               alicepk, bobsk));
+    crypto_box_cache_stats(cache, &hits, &misses);
+    printf("hits: %llu misses: %llu\n", hits, misses);
+
+    printf("%d\n", crypto_box_easy_cached(cache, c, m, sizeof m, nonce,
+                                          small_order_p, alicesk));
+    printf("%d\n", crypto_box_cache_beforenm(cache, k1, small_order_p,
+                                             alicesk));
+    crypto_box_cache_free(cache);
+
+    /* 100 peers in a cache that can only hold 16 shared keys */
+    cache = crypto_box_cache_new(1U);
+    for (i = 0U; i < 100U; i++) {
+        crypto_box_keypair(peerpks + i * crypto_box_PUBLICKEYBYTES,
+                           peersks + i * crypto_box_SECRETKEYBYTES);
+    }
+    for (j = 0U; j < 3U; j++) {
+        for (i = 0U; i < 100U; i++) {
+            if (crypto_box_cache_beforenm
+                (cache, k1, peerpks + i * crypto_box_PUBLICKEYBYTES,
+                 alicesk) != 0 ||
+                crypto_box_beforenm
+                (k2, peerpks + i * crypto_box_PUBLICKEYBYTES, alicesk) != 0) {
+                printf("crypto_box_cache_beforenm() failed\n");
+            }
+            if (memcmp(k1, k2, sizeof k1) != 0) {
+                printf("crypto_box_cache_beforenm() mismatch: [%u]\n", i);
+            }
+        }
+    }
+    crypto_box_cache_stats(cache, &hits, &misses);
+    printf("lookups: %llu\n", hits + misses);
+    assert(misses > hits);
+    crypto_box_cache_free(cache);
+    crypto_box_cache_free(NULL);
+
+    printf("OK\n");
+
+    return 0;
+}
@@ -4,13 +4,23 @@
 
 int main(void)
 {
+    crypto_box_seal_pool *pool;
     unsigned char pk[crypto_box_PUBLICKEYBYTES];
+    unsigned char epks[21 * crypto_box_PUBLICKEYBYTES];
+    unsigned char rpks[3][crypto_box_PUBLICKEYBYTES];
+    unsigned char rsks[3][crypto_box_SECRETKEYBYTES];
+    const unsigned char *rpks_p[3];
+    unsigned char *mc;
+    size_t         mc_len;
+    unsigned long long m2_len;
     unsigned char sk[crypto_box_SECRETKEYBYTES];
     unsigned char *c;
     unsigned char *m;
     unsigned char *m2;
     size_t         m_len;
     size_t         c_len;
+    size_t         i;
+    size_t         j;
 
     crypto_box_keypair(pk, sk);
     m_len = (size_t) randombytes_uniform(1000);
@@ -33,11 +43,90 @@ int main(void)
     printf("%d\n", crypto_box_seal_open(m, c, c_len - 1U, pk, sk));
     printf("%d\n", crypto_box_seal_open(m, c, c_len, sk, pk));
 
+    assert(crypto_box_seal_pool_new(0U) == NULL);
+    pool = crypto_box_seal_pool_new(20U);
+    assert(pool != NULL);
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_available(pool));
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_refill(pool, 5U));
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_available(pool));
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_refill(pool, 0U));
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_refill(pool, 0U));
+    for (i = 0U; i < 21U; i++) {
+        if (crypto_box_seal_pooled(pool, c, m, m_len, pk) != 0) {
+            printf("crypto_box_seal_pooled() failure\n");
+        }
+        if (crypto_box_seal_open(m2, c, c_len, pk, sk) != 0 ||
+            memcmp(m, m2, m_len) != 0) {
+            printf("crypto_box_seal_open() failure: [%u]\n", (unsigned int) i);
+        }
+        memcpy(epks + i * crypto_box_PUBLICKEYBYTES, c,
+               crypto_box_PUBLICKEYBYTES);
+        for (j = 0U; j < i; j++) {
+            if (memcmp(epks + j * crypto_box_PUBLICKEYBYTES, c,
+                       crypto_box_PUBLICKEYBYTES) == 0) {
+                printf("ephemeral key reused: [%u]\n", (unsigned int) i);
+            }
+        }
+    }
+    printf("%u\n", (unsigned int) crypto_box_seal_pool_available(pool));
+    crypto_box_seal_pool_free(pool);
+    crypto_box_seal_pool_free(NULL);
+
+    if (crypto_box_seal_pooled(NULL, c, m, m_len, pk) != 0 ||
+        crypto_box_seal_open(m2, c, c_len, pk, sk) != 0) {
+        printf("crypto_box_seal_pooled() without a pool failure\n");
+    }
+
+    for (i = 0U; i < 3U; i++) {
+        crypto_box_keypair(rpks[i], rsks[i]);
+        rpks_p[i] = rpks[i];
+    }
+    mc_len = crypto_box_SEALMULTI_HEADERBYTES +
+        3U * crypto_box_SEALMULTI_SLOTBYTES + crypto_box_MACBYTES + m_len;
+    mc = (unsigned char *) sodium_malloc(mc_len);
+    if (crypto_box_seal_multi(mc, m, m_len, rpks_p, 3U) != 0) {
+        printf("crypto_box_seal_multi() failure\n");
+    }
+    for (i = 0U; i < 3U; i++) {
+        memset(m2, 0, m_len);
+        if (crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len,
+                                       rpks[i], rsks[i]) != 0 ||
+            m2_len != m_len || memcmp(m, m2, m_len) != 0) {
+            printf("crypto_box_seal_multi_open() failure: [%u]\n",
+                   (unsigned int) i);
+        }
+    }
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len, pk, sk));
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len - 1U,
+                                              rpks[0], rsks[0]));
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc,
+                                              crypto_box_SEALMULTI_HEADERBYTES,
+                                              rpks[0], rsks[0]));
+    mc[crypto_box_SEALMULTI_HEADERBYTES + 10U] ^= 1;
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len,
+                                              rpks[0], rsks[0]));
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len,
+                                              rpks[1], rsks[1]));
+    mc[mc_len - 1U] ^= 1;
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len,
+                                              rpks[2], rsks[2]));
+    sodium_free(mc);
+
+    mc_len = crypto_box_SEALMULTI_HEADERBYTES + crypto_box_MACBYTES + m_len;
+    mc = (unsigned char *) sodium_malloc(mc_len);
+    printf("%d\n", crypto_box_seal_multi(mc, m, m_len, rpks_p, 0U));
+    printf("%d\n", crypto_box_seal_multi_open(m2, &m2_len, mc, mc_len,
+                                              rpks[0], rsks[0]));
+    sodium_free(mc);
+
     sodium_free(c);
     sodium_free(m);
     sodium_free(m2);
 
     assert(crypto_box_sealbytes() == crypto_box_SEALBYTES);
+    assert(crypto_box_sealmulti_headerbytes() ==
+           crypto_box_SEALMULTI_HEADERBYTES);
+    assert(crypto_box_sealmulti_slotbytes() == crypto_box_SEALMULTI_SLOTBYTES);
 
     return 0;
 }
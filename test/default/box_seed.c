@@ -10,8 +10,12 @@ static unsigned char seed[32]
 int main(void)
 {
     int i;
+    int j;
     unsigned char sk[32];
     unsigned char pk[32];
+    unsigned char seeds[37 * 32];
+    unsigned char sks[37 * 32];
+    unsigned char pks[37 * 32];
 
     crypto_box_seed_keypair(pk, sk, seed);
     for (i = 0; i < 32; ++i) {
@@ -24,5 +28,26 @@ int main(void)
         if (i % 8 == 7)
             printf("\n");
     }
+
+    for (i = 0; i < 37; ++i) {
+        for (j = 0; j < 32; ++j) {
+            seeds[i * 32 + j] = seed[j] ^ (unsigned char) i;
+        }
+    }
+    crypto_box_seed_keypair_batch(pks, sks, seeds, 37);
+    for (i = 0; i < 37; ++i) {
+        crypto_box_seed_keypair(pk, sk, seeds + i * 32);
+        if (memcmp(pk, pks + i * 32, 32) != 0 ||
+            memcmp(sk, sks + i * 32, 32) != 0) {
+            printf("crypto_box_seed_keypair_batch() mismatch: [%d]\n", i);
+        }
+    }
+    crypto_box_keypair_batch(pks, sks, 37);
+    for (i = 0; i < 37; ++i) {
+        crypto_scalarmult_base(pk, sks + i * 32);
+        if (memcmp(pk, pks + i * 32, 32) != 0) {
+            printf("crypto_box_keypair_batch() mismatch: [%d]\n", i);
+        }
+    }
     return 0;
 }
@@ -29,7 +29,51 @@
 
 int xmain(void);
 
-#ifndef BROWSER_TESTS
+#ifdef BENCHMARKS
+
+# include <sys/time.h>
+
+# ifndef ITERATIONS
+#  define ITERATIONS 128
+# endif
+
+static unsigned long long now(void)
+{
+    struct timeval tp;
+
+    if (gettimeofday(&tp, NULL) != 0) {
+        abort();
+    }
+    return (unsigned long long) tp.tv_sec * 1000000ULL +
+        (unsigned long long) tp.tv_usec;
+}
+
+int main(void)
+{
+    unsigned long long ts_start;
+    unsigned long long ts_end;
+    unsigned int       i;
+
+    if (sodium_init() != 0) {
+        return 99;
+    }
+    ts_start = now();
+    for (i = 0; i < ITERATIONS; i++) {
+        if (xmain() != 0) {
+            return 99;
+        }
+    }
+    ts_end = now();
+    printf("%s: %llu usec/iteration\n", TEST_NAME,
+           (ts_end - ts_start) / ITERATIONS);
+
+    return 0;
+}
+
+#undef  printf
+#define printf(...) do { } while(0)
+
+#elif !defined(BROWSER_TESTS)
 
 FILE *fp_res;
 
@@ -6,10 +6,12 @@ int
 main(void)
 {
 #define MAXLEN 64
+#define BIGLEN 1031
     crypto_generichash_state st;
     unsigned char in[MAXLEN], out[crypto_generichash_BYTES_MAX],
         k[crypto_generichash_KEYBYTES_MAX];
-    size_t h, i, j;
+    unsigned char big[BIGLEN + 1], out2[crypto_generichash_BYTES_MAX];
+    size_t h, i, j, l;
 
     assert(crypto_generichash_statebytes() >= sizeof st);
     for (h = 0; h < crypto_generichash_KEYBYTES_MAX; ++h)
@@ -40,6 +42,20 @@ main(void)
         }
     }
 
+    /* streaming in chunks of any size, from unaligned pointers */
+    for (i = 0; i < sizeof big; ++i)
+        big[i] = (unsigned char) (i * 13);
+    crypto_generichash(out, sizeof out, big + 1, BIGLEN, k, sizeof k);
+    for (l = 1; l <= BIGLEN; l = l * 2 + 1) {
+        crypto_generichash_init(&st, k, sizeof k, sizeof out2);
+        for (j = 0; j < BIGLEN; j += l) {
+            crypto_generichash_update(&st, big + 1 + j,
+                                      BIGLEN - j < l ? BIGLEN - j : l);
+        }
+        crypto_generichash_final(&st, out2, sizeof out2);
+        assert(memcmp(out, out2, sizeof out) == 0);
+    }
+
     assert(crypto_generichash_init(&st, k, sizeof k, 0U) == -1);
     assert(crypto_generichash_init(&st, k, sizeof k,
                                    crypto_generichash_BYTES_MAX + 1U) == -1);
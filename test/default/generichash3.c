@@ -7,6 +7,7 @@ main(void)
 {
 #define MAXLEN 64
     crypto_generichash_blake2b_state st;
+    crypto_generichash_blake2b_state prepared;
     unsigned char salt[crypto_generichash_blake2b_SALTBYTES]
         = { '5', 'b', '6', 'b', '4', '1', 'e', 'd',
             '9', 'b', '3', '4', '3', 'f', 'e', '0' };
@@ -15,6 +16,7 @@ main(void)
             '3', '7', '4', '0', '0', 'd', '2', 'a' };
     unsigned char in[MAXLEN];
     unsigned char out[crypto_generichash_blake2b_BYTES_MAX];
+    unsigned char out2[crypto_generichash_blake2b_BYTES_MAX];
     unsigned char k[crypto_generichash_blake2b_KEYBYTES_MAX];
     size_t        h;
     size_t        i;
@@ -172,5 +174,37 @@ main(void)
                                                          NULL, personal) == 0);
     assert(crypto_generichash_blake2b_init_salt_personal(&st, k, sizeof k, crypto_generichash_BYTES,
                                                          salt, NULL) == 0);
+
+    /* prepared keyed states must give the same results as a fresh init */
+    assert(crypto_generichash_blake2b_keyed_prepare
+           (&prepared, k, sizeof k, crypto_generichash_blake2b_BYTES_MAX + 1) == -1);
+    for (i = 0; i <= MAXLEN; i += 7) {
+        for (h = 0; h < 4; h++) {
+            assert(crypto_generichash_blake2b_keyed_prepare_salt_personal
+                   (&prepared, h & 1 ? k : NULL, h & 1 ? 1 + i % sizeof k : 0U,
+                    crypto_generichash_blake2b_BYTES_MAX,
+                    h & 2 ? salt : NULL, h & 2 ? personal : NULL) == 0);
+            crypto_generichash_blake2b_init_salt_personal
+                (&st, h & 1 ? k : NULL, h & 1 ? 1 + i % sizeof k : 0U,
+                 crypto_generichash_blake2b_BYTES_MAX,
+                 h & 2 ? salt : NULL, h & 2 ? personal : NULL);
+            crypto_generichash_blake2b_update(&st, in, i);
+            crypto_generichash_blake2b_final(&st, out, crypto_generichash_blake2b_BYTES_MAX);
+            for (j = 0; j < 2; j++) {
+                crypto_generichash_blake2b_reset(&st, &prepared);
+                crypto_generichash_blake2b_update(&st, in, i);
+                crypto_generichash_blake2b_final(&st, out2, crypto_generichash_blake2b_BYTES_MAX);
+                assert(memcmp(out, out2, crypto_generichash_blake2b_BYTES_MAX) == 0);
+            }
+        }
+    }
+    assert(crypto_generichash_blake2b_keyed_prepare
+           (&prepared, k, 32U, crypto_generichash_blake2b_BYTES) == 0);
+    crypto_generichash_blake2b_reset(&st, &prepared);
+    crypto_generichash_blake2b_final(&st, out, crypto_generichash_blake2b_BYTES);
+    crypto_generichash_blake2b(out2, crypto_generichash_blake2b_BYTES, NULL, 0U,
+                               k, 32U);
+    assert(memcmp(out, out2, crypto_generichash_blake2b_BYTES) == 0);
+
     return 0;
 }
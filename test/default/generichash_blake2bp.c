@@ -0,0 +1,84 @@
+
+#define TEST_NAME "generichash_blake2bp"
+#include "cmptest.h"
+
+#define BIGLEN (1024 * 1024 + 129)
+
+static const size_t lens[] = { 0, 1, 127, 128, 129, 255, 256, 511, 512, 513,
+                               1023, 1024, 2047, 2048, 4096 + 17 };
+
+int
+main(void)
+{
+    crypto_generichash_blake2bp_state st;
+    unsigned char                     k[crypto_generichash_blake2bp_KEYBYTES_MAX];
+    unsigned char                     out[crypto_generichash_blake2bp_BYTES_MAX];
+    unsigned char                     out2[crypto_generichash_blake2bp_BYTES_MAX];
+    char                              hex[2 * sizeof out + 1];
+    unsigned char                    *in;
+    size_t                            i;
+    size_t                            j;
+    size_t                            l;
+
+    in = (unsigned char *) sodium_malloc(BIGLEN);
+    for (i = 0; i < BIGLEN; i++) {
+        in[i] = (unsigned char) i;
+    }
+    for (i = 0; i < sizeof k; i++) {
+        k[i] = (unsigned char) i;
+    }
+    for (i = 0; i < sizeof lens / sizeof lens[0]; i++) {
+        crypto_generichash_blake2bp(out, sizeof out, in, lens[i], k, sizeof k);
+        printf("%s\n", sodium_bin2hex(hex, sizeof hex, out, sizeof out));
+
+        for (l = 1; l <= 1024; l = l * 3 + 1) {
+            crypto_generichash_blake2bp_init(&st, k, sizeof k, sizeof out);
+            for (j = 0; j < lens[i]; j += l) {
+                crypto_generichash_blake2bp_update(&st, in + j,
+                                                   lens[i] - j < l ? lens[i] - j : l);
+            }
+            crypto_generichash_blake2bp_final(&st, out2, sizeof out2);
+            if (memcmp(out, out2, sizeof out) != 0) {
+                printf("streaming mismatch (len=%u, chunk=%u)\n",
+                       (unsigned int) lens[i], (unsigned int) l);
+            }
+        }
+    }
+
+    crypto_generichash_blake2bp(out, crypto_generichash_blake2bp_BYTES,
+                                in, 1000, NULL, 0);
+    printf("%s\n", sodium_bin2hex(hex, sizeof hex, out,
+                                  crypto_generichash_blake2bp_BYTES));
+
+    crypto_generichash_blake2bp(out, sizeof out, in, BIGLEN, k, 32U);
+    printf("%s\n", sodium_bin2hex(hex, sizeof hex, out, sizeof out));
+    for (j = 1; j <= 5; j++) {
+        crypto_generichash_blake2bp_threaded(out2, sizeof out2, in, BIGLEN,
+                                             k, 32U, j);
+        printf("%d ", memcmp(out, out2, sizeof out));
+    }
+    printf("\n");
+
+    crypto_generichash_blake2bp_init(&st, NULL, 0U, sizeof out);
+    crypto_generichash_blake2bp_update(&st, in, 100U);
+    printf("%d ", crypto_generichash_blake2bp_final(&st, out, sizeof out - 1U));
+    printf("%d ", crypto_generichash_blake2bp_final(&st, out, sizeof out));
+    printf("%d ", crypto_generichash_blake2bp_final(&st, out, sizeof out));
+    printf("%d ", crypto_generichash_blake2bp(out, 0U, in, 1U, NULL, 0U));
+    printf("%d ", crypto_generichash_blake2bp(out, sizeof out + 1U, in, 1U,
+                                              NULL, 0U));
+    printf("%d\n", crypto_generichash_blake2bp_init(&st, k, sizeof k + 1U,
+                                                    sizeof out));
+
+    sodium_free(in);
+
+    assert(crypto_generichash_blake2bp_statebytes() >= sizeof st);
+    assert(crypto_generichash_blake2bp_bytes() == crypto_generichash_blake2bp_BYTES);
+    assert(crypto_generichash_blake2bp_bytes_min() == crypto_generichash_blake2bp_BYTES_MIN);
+    assert(crypto_generichash_blake2bp_bytes_max() == crypto_generichash_blake2bp_BYTES_MAX);
+    assert(crypto_generichash_blake2bp_keybytes() == crypto_generichash_blake2bp_KEYBYTES);
+    assert(crypto_generichash_blake2bp_keybytes_min() == crypto_generichash_blake2bp_KEYBYTES_MIN);
+    assert(crypto_generichash_blake2bp_keybytes_max() == crypto_generichash_blake2bp_KEYBYTES_MAX);
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+
+#define TEST_NAME "generichash_blake2s"
+#include "cmptest.h"
+
+#define MAXLEN 256
+
+int
+main(void)
+{
+    crypto_generichash_blake2s_state st;
+    unsigned char salt[crypto_generichash_blake2s_SALTBYTES]
+        = { '5', 'b', '6', 'b', '4', '1', 'e', 'd' };
+    unsigned char personal[crypto_generichash_blake2s_PERSONALBYTES]
+        = { '5', '1', '2', '6', 'f', 'b', '2', 'a' };
+    unsigned char in[MAXLEN];
+    unsigned char out[crypto_generichash_blake2s_BYTES_MAX];
+    unsigned char out2[crypto_generichash_blake2s_BYTES_MAX];
+    unsigned char k[crypto_generichash_blake2s_KEYBYTES_MAX];
+    size_t        h;
+    size_t        i;
+    size_t        j;
+
+    for (h = 0; h < crypto_generichash_blake2s_KEYBYTES_MAX; ++h) {
+        k[h] = (unsigned char) h;
+    }
+    for (i = 0; i < MAXLEN; ++i) {
+        in[i] = (unsigned char) i;
+    }
+    for (i = 0; i < MAXLEN; i += 7) {
+        crypto_generichash_blake2s(out, 1 + i % crypto_generichash_blake2s_BYTES_MAX,
+                                   in, (unsigned long long) i, k,
+                                   i % (crypto_generichash_blake2s_KEYBYTES_MAX + 1));
+        for (j = 0; j < 1 + i % crypto_generichash_blake2s_BYTES_MAX; ++j) {
+            printf("%02x", (unsigned int) out[j]);
+        }
+        printf("\n");
+
+        crypto_generichash_blake2s_init(&st, k,
+                                        i % (crypto_generichash_blake2s_KEYBYTES_MAX + 1),
+                                        1 + i % crypto_generichash_blake2s_BYTES_MAX);
+        for (j = 0; j < i; j += 1 + j % 67) {
+            crypto_generichash_blake2s_update(&st, in + j,
+                                              (1 + j % 67) < i - j ? (1 + j % 67) : i - j);
+        }
+        crypto_generichash_blake2s_final(&st, out2,
+                                         1 + i % crypto_generichash_blake2s_BYTES_MAX);
+        if (memcmp(out, out2, 1 + i % crypto_generichash_blake2s_BYTES_MAX) != 0) {
+            printf("streaming mismatch (len=%u)\n", (unsigned int) i);
+        }
+    }
+
+    crypto_generichash_blake2s_salt_personal(out, sizeof out, in, 100U,
+                                             k, sizeof k, salt, personal);
+    for (j = 0; j < sizeof out; ++j) {
+        printf("%02x", (unsigned int) out[j]);
+    }
+    printf("\n");
+    crypto_generichash_blake2s_init_salt_personal(&st, NULL, 0U, sizeof out,
+                                                  salt, personal);
+    crypto_generichash_blake2s_update(&st, in, 100U);
+    crypto_generichash_blake2s_final(&st, out, sizeof out);
+    for (j = 0; j < sizeof out; ++j) {
+        printf("%02x", (unsigned int) out[j]);
+    }
+    printf("\n");
+
+    printf("%d ", crypto_generichash_blake2s_final(&st, out, sizeof out));
+    printf("%d ", crypto_generichash_blake2s(out, 0U, in, 1U, NULL, 0U));
+    printf("%d ", crypto_generichash_blake2s(out, sizeof out + 1U, in, 1U,
+                                             NULL, 0U));
+    printf("%d\n", crypto_generichash_blake2s_init(&st, k, sizeof k + 1U,
+                                                   sizeof out));
+
+    assert(crypto_generichash_blake2s_statebytes() >= sizeof st);
+    assert(crypto_generichash_blake2s_bytes() == crypto_generichash_blake2s_BYTES);
+    assert(crypto_generichash_blake2s_bytes_min() == crypto_generichash_blake2s_BYTES_MIN);
+    assert(crypto_generichash_blake2s_bytes_max() == crypto_generichash_blake2s_BYTES_MAX);
+    assert(crypto_generichash_blake2s_keybytes() == crypto_generichash_blake2s_KEYBYTES);
+    assert(crypto_generichash_blake2s_keybytes_min() == crypto_generichash_blake2s_KEYBYTES_MIN);
+    assert(crypto_generichash_blake2s_keybytes_max() == crypto_generichash_blake2s_KEYBYTES_MAX);
+    assert(crypto_generichash_blake2s_saltbytes() == crypto_generichash_blake2s_SALTBYTES);
+    assert(crypto_generichash_blake2s_personalbytes() == crypto_generichash_blake2s_PERSONALBYTES);
+
+    return 0;
+}
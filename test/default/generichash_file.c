@@ -0,0 +1,109 @@
+
+#define TEST_NAME "generichash_file"
+#include "cmptest.h"
+
+#include <fcntl.h>
+#ifdef _WIN32
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
+
+#ifndef O_BINARY
+# define O_BINARY 0
+#endif
+
+#define FILELEN (3 * 1024 * 1024 + 4097)
+#define TMPNAME "generichash_file.tmp"
+
+int
+main(void)
+{
+    unsigned char  k[crypto_generichash_KEYBYTES];
+    unsigned char  out[crypto_generichash_BYTES_MAX];
+    unsigned char  out2[crypto_generichash_BYTES_MAX];
+    char           hex[2 * crypto_generichash_BYTES_MAX + 1];
+    unsigned char *buf;
+    FILE          *fp;
+    size_t         i;
+    int            fd;
+
+    buf = (unsigned char *) sodium_malloc(FILELEN);
+    for (i = 0; i < FILELEN; i++) {
+        buf[i] = (unsigned char) (i * 31 + (i >> 12));
+    }
+    for (i = 0; i < sizeof k; i++) {
+        k[i] = (unsigned char) i;
+    }
+    fp = fopen(TMPNAME, "wb");
+    assert(fp != NULL);
+    assert(fwrite(buf, 1, FILELEN, fp) == FILELEN);
+    fclose(fp);
+
+    assert(crypto_generichash_file(out, sizeof out, TMPNAME, k, sizeof k) == 0);
+    crypto_generichash(out2, sizeof out2, buf, FILELEN, k, sizeof k);
+    printf("%d\n", memcmp(out, out2, sizeof out));
+    printf("%s\n", sodium_bin2hex(hex, sizeof hex, out, sizeof out));
+
+    assert(crypto_generichash_file(out, crypto_generichash_BYTES, TMPNAME,
+                                   NULL, 0U) == 0);
+    crypto_generichash(out2, crypto_generichash_BYTES, buf, FILELEN, NULL, 0U);
+    printf("%d\n", memcmp(out, out2, crypto_generichash_BYTES));
+
+    for (i = 1; i <= 4; i++) {
+        assert(crypto_generichash_blake2bp_file(out, sizeof out, TMPNAME,
+                                                k, sizeof k, i) == 0);
+        crypto_generichash_blake2bp(out2, sizeof out2, buf, FILELEN,
+                                    k, sizeof k);
+        printf("%d ", memcmp(out, out2, sizeof out));
+    }
+    printf("\n");
+
+    /* hashing starts at the current offset, and consumes the file */
+    fd = open(TMPNAME, O_RDONLY | O_BINARY);
+    assert(fd != -1);
+    assert(lseek(fd, 12345, SEEK_SET) == 12345);
+    assert(crypto_generichash_fd(out, sizeof out, fd, NULL, 0U) == 0);
+    crypto_generichash(out2, sizeof out2, buf + 12345, FILELEN - 12345,
+                       NULL, 0U);
+    printf("%d\n", memcmp(out, out2, sizeof out));
+    assert(crypto_generichash_fd(out, sizeof out, fd, NULL, 0U) == 0);
+    crypto_generichash(out2, sizeof out2, NULL, 0U, NULL, 0U);
+    printf("%d\n", memcmp(out, out2, sizeof out));
+    assert(lseek(fd, 99, SEEK_SET) == 99);
+    assert(crypto_generichash_blake2bp_fd(out, sizeof out, fd,
+                                          k, sizeof k, 2U) == 0);
+    crypto_generichash_blake2bp(out2, sizeof out2, buf + 99, FILELEN - 99,
+                                k, sizeof k);
+    printf("%d\n", memcmp(out, out2, sizeof out));
+    close(fd);
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    {
+        int fds[2];
+
+        /* not a regular file: falls back to read() */
+        assert(pipe(fds) == 0);
+        assert(write(fds[1], buf, 1000) == 1000);
+        close(fds[1]);
+        assert(crypto_generichash_fd(out, sizeof out, fds[0], k, sizeof k) == 0);
+        close(fds[0]);
+        crypto_generichash(out2, sizeof out2, buf, 1000, k, sizeof k);
+        printf("%d\n", memcmp(out, out2, sizeof out));
+    }
+#else
+    printf("0\n");
+#endif
+
+    assert(crypto_generichash_file(out, 0U, TMPNAME, NULL, 0U) == -1);
+    assert(crypto_generichash_file(out, crypto_generichash_BYTES_MAX + 1U,
+                                   TMPNAME, NULL, 0U) == -1);
+    assert(crypto_generichash_file(out, sizeof out, TMPNAME,
+                                   k, crypto_generichash_KEYBYTES_MAX + 1U) == -1);
+    remove(TMPNAME);
+    assert(crypto_generichash_file(out, sizeof out, TMPNAME, NULL, 0U) == -1);
+    assert(crypto_generichash_fd(out, sizeof out, -1, NULL, 0U) == -1);
+    sodium_free(buf);
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+
+#define TEST_NAME "generichash_multi"
+#include "cmptest.h"
+
+#define MAXMSGS 13
+
+static const unsigned long long lens[MAXMSGS] = {
+    0, 1, 127, 128, 129, 255, 256, 1000, 16, 64, 3, 4096 + 17, 32
+};
+
+int
+main(void)
+{
+    unsigned char        k[crypto_generichash_blake2b_KEYBYTES_MAX];
+    unsigned char        outs[MAXMSGS][crypto_generichash_blake2b_BYTES_MAX];
+    unsigned char        out2[crypto_generichash_blake2b_BYTES_MAX];
+    char                 hex[2 * crypto_generichash_blake2b_BYTES_MAX + 1];
+    unsigned char       *out[MAXMSGS];
+    const unsigned char *in[MAXMSGS];
+    unsigned char       *buf;
+    size_t               i;
+    size_t               keylen;
+    size_t               n;
+    size_t               outlen;
+    int                  mismatches = 0;
+
+    buf = (unsigned char *) sodium_malloc(MAXMSGS * 8192);
+    for (i = 0; i < MAXMSGS * 8192; i++) {
+        buf[i] = (unsigned char) (i * 7 + (i >> 8));
+    }
+    for (i = 0; i < sizeof k; i++) {
+        k[i] = (unsigned char) i;
+    }
+    for (i = 0; i < MAXMSGS; i++) {
+        in[i] = buf + i * 8192;
+        out[i] = outs[i];
+    }
+    for (keylen = 0; keylen <= sizeof k; keylen += 32) {
+        for (outlen = 16; outlen <= crypto_generichash_blake2b_BYTES_MAX;
+             outlen += 16) {
+            for (n = 0; n <= MAXMSGS; n++) {
+                memset(outs, 0, sizeof outs);
+                assert(crypto_generichash_blake2b_multi(out, outlen, in, lens,
+                                                        keylen > 0 ? k : NULL,
+                                                        keylen, n) == 0);
+                for (i = 0; i < n; i++) {
+                    crypto_generichash_blake2b(out2, outlen, in[i], lens[i],
+                                               keylen > 0 ? k : NULL, keylen);
+                    if (memcmp(outs[i], out2, outlen) != 0) {
+                        printf("mismatch (key=%u, out=%u, n=%u, msg=%u)\n",
+                               (unsigned int) keylen, (unsigned int) outlen,
+                               (unsigned int) n, (unsigned int) i);
+                        mismatches++;
+                    }
+                }
+            }
+        }
+    }
+    printf("mismatches: %d\n", mismatches);
+
+    crypto_generichash_blake2b_multi(out, crypto_generichash_blake2b_BYTES,
+                                     in, lens, k, 32U, 4U);
+    for (i = 0; i < 4; i++) {
+        printf("%s\n", sodium_bin2hex(hex, sizeof hex, outs[i],
+                                      crypto_generichash_blake2b_BYTES));
+    }
+    assert(crypto_generichash_blake2b_multi(out, 0U, in, lens,
+                                            NULL, 0U, 1U) == -1);
+    assert(crypto_generichash_blake2b_multi(out, 65U, in, lens,
+                                            NULL, 0U, 1U) == -1);
+    assert(crypto_generichash_blake2b_multi(out, 32U, in, lens,
+                                            k, 65U, 1U) == -1);
+    sodium_free(buf);
+
+    return 0;
+}
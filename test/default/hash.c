@@ -6,6 +6,45 @@ static unsigned char x[] = "testing\n";
 static unsigned char x2[] = "The Conscience of a Hacker is a small essay written January 8, 1986 by a computer security hacker who went by the handle of The Mentor, who belonged to the 2nd generation of Legion of Doom.";
 static unsigned char h[crypto_hash_BYTES];
 
+static void
+tv_multi(void)
+{
+    unsigned char       *buf;
+    unsigned char       *hs;
+    const unsigned char *in[100];
+    unsigned long long   inlen[100];
+    size_t               i;
+
+    buf = (unsigned char *) sodium_malloc(100 * 300);
+    hs = (unsigned char *) sodium_malloc(100 * crypto_hash_sha512_BYTES);
+    randombytes_buf(buf, 100 * 300);
+    for (i = 0; i < 100; i++) {
+        in[i] = &buf[i * 300];
+        inlen[i] = (i * 97) % 300;
+    }
+    crypto_hash_sha256_multi(hs, in, inlen, 100);
+    for (i = 0; i < 100; i++) {
+        crypto_hash_sha256(h, in[i], inlen[i]);
+        if (memcmp(h, &hs[i * crypto_hash_sha256_BYTES],
+                   crypto_hash_sha256_BYTES) != 0) {
+            printf("multi: mismatch for message %u\n", (unsigned int) i);
+        }
+    }
+    crypto_hash_sha256_multi(hs, in, inlen, 0);
+
+    crypto_hash_sha512_multi(hs, in, inlen, 100);
+    for (i = 0; i < 100; i++) {
+        crypto_hash_sha512(h, in[i], inlen[i]);
+        if (memcmp(h, &hs[i * crypto_hash_sha512_BYTES],
+                   crypto_hash_sha512_BYTES) != 0) {
+            printf("multi512: mismatch for message %u\n", (unsigned int) i);
+        }
+    }
+    crypto_hash_sha512_multi(hs, in, inlen, 0);
+    sodium_free(hs);
+    sodium_free(buf);
+}
+
 int main(void)
 {
     size_t i;
@@ -31,6 +70,8 @@ int main(void)
     }
     printf("\n");
 
+    tv_multi();
+
     assert(crypto_hash_bytes() > 0U);
     assert(strcmp(crypto_hash_primitive(), "sha512") == 0);
     assert(crypto_hash_sha256_bytes() > 0U);
@@ -0,0 +1,145 @@
+
+#define TEST_NAME "kdf_hkdf"
+#include "cmptest.h"
+
+/* "Test Case 1" from RFC 5869 */
+static const unsigned char ikm[22] = {
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+};
+static const unsigned char salt[13] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c
+};
+static const char info[10] = {
+    '\xf0', '\xf1', '\xf2', '\xf3', '\xf4', '\xf5', '\xf6', '\xf7', '\xf8',
+    '\xf9'
+};
+
+static const char *ctxs[] = { "first subkey", "second subkey", "", "4th" };
+
+static void
+tv_hkdf_sha256(void)
+{
+    crypto_kdf_hkdf_sha256_prk_state state;
+    unsigned char                    prk[crypto_kdf_hkdf_sha256_KEYBYTES];
+    unsigned char                    okm[42];
+    unsigned char                    out[4 * 80];
+    unsigned char                    out2[80];
+    char                             hex[2 * sizeof out + 1];
+    size_t                           ctx_lens[4];
+    size_t                           i;
+
+    crypto_kdf_hkdf_sha256_extract(prk, salt, sizeof salt, ikm, sizeof ikm);
+    printf("prk: %s\n", sodium_bin2hex(hex, sizeof hex, prk, sizeof prk));
+    crypto_kdf_hkdf_sha256_expand(okm, sizeof okm, info, sizeof info, prk);
+    printf("okm: %s\n", sodium_bin2hex(hex, sizeof hex, okm, sizeof okm));
+
+    crypto_kdf_hkdf_sha256_prk_init(&state, prk);
+    for (i = 0; i <= sizeof okm; i++) {
+        memset(out, 0, sizeof okm);
+        crypto_kdf_hkdf_sha256_expand_from_state(out, i, info, sizeof info,
+                                                 &state);
+        if (memcmp(out, okm, i) != 0 ||
+            (i < sizeof okm && out[i] != 0)) {
+            printf("expand_from_state(%u) failed\n", (unsigned int) i);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        ctx_lens[i] = strlen(ctxs[i]);
+    }
+    crypto_kdf_hkdf_sha256_expand_batch(out, 80U, ctxs, ctx_lens, 4U, prk);
+    for (i = 0; i < 4; i++) {
+        crypto_kdf_hkdf_sha256_expand(out2, 80U, ctxs[i], ctx_lens[i], prk);
+        printf("%d ", memcmp(out2, &out[i * 80U], 80U));
+    }
+    printf("\n");
+
+    crypto_kdf_hkdf_sha256_extract(prk, NULL, 0U, ikm, sizeof ikm);
+    printf("prk (no salt): %s\n",
+           sodium_bin2hex(hex, sizeof hex, prk, sizeof prk));
+
+    printf("%d %d\n",
+           crypto_kdf_hkdf_sha256_expand(out, crypto_kdf_hkdf_sha256_BYTES_MAX + 1U,
+                                         NULL, 0U, prk),
+           crypto_kdf_hkdf_sha256_expand_batch(out, crypto_kdf_hkdf_sha256_BYTES_MAX + 1U,
+                                               ctxs, ctx_lens, 0U, prk));
+
+    assert(crypto_kdf_hkdf_sha256_keybytes() == crypto_kdf_hkdf_sha256_KEYBYTES);
+    assert(crypto_kdf_hkdf_sha256_bytes_min() == crypto_kdf_hkdf_sha256_BYTES_MIN);
+    assert(crypto_kdf_hkdf_sha256_bytes_max() == crypto_kdf_hkdf_sha256_BYTES_MAX);
+    assert(crypto_kdf_hkdf_sha256_prk_statebytes() == sizeof state);
+}
+static void
+tv_hkdf_sha512(void)
+{
+    crypto_kdf_hkdf_sha512_prk_state state;
+    unsigned char                    prk[crypto_kdf_hkdf_sha512_KEYBYTES];
+    unsigned char                    okm[42];
+    unsigned char                    out[4 * 150];
+    unsigned char                    out2[150];
+    char                             hex[2 * sizeof out + 1];
+    size_t                           ctx_lens[4];
+    size_t                           i;
+
+    crypto_kdf_hkdf_sha512_extract(prk, salt, sizeof salt, ikm, sizeof ikm);
+    printf("prk: %s\n", sodium_bin2hex(hex, sizeof hex, prk, sizeof prk));
+    crypto_kdf_hkdf_sha512_expand(okm, sizeof okm, info, sizeof info, prk);
+    printf("okm: %s\n", sodium_bin2hex(hex, sizeof hex, okm, sizeof okm));
+
+    crypto_kdf_hkdf_sha512_prk_init(&state, prk);
+    for (i = 0; i <= sizeof okm; i++) {
+        memset(out, 0, sizeof okm);
+        crypto_kdf_hkdf_sha512_expand_from_state(out, i, info, sizeof info,
+                                                 &state);
+        if (memcmp(out, okm, i) != 0 ||
+            (i < sizeof okm && out[i] != 0)) {
+            printf("expand_from_state(%u) failed\n", (unsigned int) i);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        ctx_lens[i] = strlen(ctxs[i]);
+    }
+    crypto_kdf_hkdf_sha512_expand_batch(out, 150U, ctxs, ctx_lens, 4U, prk);
+    for (i = 0; i < 4; i++) {
+        crypto_kdf_hkdf_sha512_expand(out2, 150U, ctxs[i], ctx_lens[i], prk);
+        printf("%d ", memcmp(out2, &out[i * 150U], 150U));
+    }
+    printf("\n");
+
+    crypto_kdf_hkdf_sha512_extract(prk, NULL, 0U, ikm, sizeof ikm);
+    printf("prk (no salt): %s\n",
+           sodium_bin2hex(hex, sizeof hex, prk, sizeof prk));
+
+    printf("%d %d\n",
+           crypto_kdf_hkdf_sha512_expand(out, crypto_kdf_hkdf_sha512_BYTES_MAX + 1U,
+                                         NULL, 0U, prk),
+           crypto_kdf_hkdf_sha512_expand_batch(out, crypto_kdf_hkdf_sha512_BYTES_MAX + 1U,
+                                               ctxs, ctx_lens, 0U, prk));
+
+    assert(crypto_kdf_hkdf_sha512_keybytes() == crypto_kdf_hkdf_sha512_KEYBYTES);
+    assert(crypto_kdf_hkdf_sha512_bytes_min() == crypto_kdf_hkdf_sha512_BYTES_MIN);
+    assert(crypto_kdf_hkdf_sha512_bytes_max() == crypto_kdf_hkdf_sha512_BYTES_MAX);
+    assert(crypto_kdf_hkdf_sha512_prk_statebytes() == sizeof state);
+}
+
+int
+main(void)
+{
+    unsigned char prk[crypto_kdf_hkdf_sha512_KEYBYTES];
+    unsigned char prk2[crypto_kdf_hkdf_sha512_KEYBYTES];
+
+    tv_hkdf_sha256();
+    tv_hkdf_sha512();
+
+    crypto_kdf_hkdf_sha256_keygen(prk);
+    crypto_kdf_hkdf_sha256_keygen(prk2);
+    assert(memcmp(prk, prk2, crypto_kdf_hkdf_sha256_KEYBYTES) != 0);
+    crypto_kdf_hkdf_sha512_keygen(prk);
+    crypto_kdf_hkdf_sha512_keygen(prk2);
+    assert(memcmp(prk, prk2, crypto_kdf_hkdf_sha512_KEYBYTES) != 0);
+
+    printf("tv_kdf_hkdf: ok\n");
+
+    return 0;
+}
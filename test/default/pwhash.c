@@ -212,6 +212,74 @@ static void tv3(void)
     } while (++i < (sizeof tests) / (sizeof tests[0]));
 }
 
+static void tv4(void)
+{
+    static struct {
+        unsigned long long  opslimit;
+        size_t              memlimit;
+        size_t              parallelism;
+        size_t              outlen;
+    } tests[] = {
+        { 3, 262144, 4, 32 },
+        { 3, 1048576, 8, 32 },
+        { 4, 98304, 3, 16 },
+        { 3, 327680, 20, 32 },
+    };
+    const char    *passwd = "correct horse battery staple";
+    char           str_out[crypto_pwhash_argon2i_STRBYTES];
+    unsigned char  salt[crypto_pwhash_argon2i_SALTBYTES];
+    unsigned char  out[32];
+    char           out_hex[32 * 2 + 1];
+    size_t         i = 0U;
+
+    for (i = 0; i < sizeof salt; i++) {
+        salt[i] = (unsigned char) i;
+    }
+    i = 0U;
+    do {
+        if (crypto_pwhash_argon2i_parallel(out, tests[i].outlen,
+                                           passwd, strlen(passwd), salt,
+                                           tests[i].opslimit, tests[i].memlimit,
+                                           tests[i].parallelism,
+                                           crypto_pwhash_ALG_ARGON2I13) != 0) {
+            printf("[tv4] pwhash_parallel failure: [%u]\n", (unsigned int) i);
+            continue;
+        }
+        sodium_bin2hex(out_hex, sizeof out_hex, out, tests[i].outlen);
+        printf("%s\n", out_hex);
+    } while (++i < (sizeof tests) / (sizeof tests[0]));
+
+    if (crypto_pwhash_argon2i_parallel(out, sizeof out, passwd, strlen(passwd),
+                                       salt, 3, 262144, 0,
+                                       crypto_pwhash_ALG_ARGON2I13) != -1) {
+        printf("[tv4] pwhash_parallel should have failed (0)\n");
+    }
+    if (crypto_pwhash_argon2i_parallel(out, sizeof out, passwd, strlen(passwd),
+                                       salt, 3, 262144, 64,
+                                       crypto_pwhash_ALG_ARGON2I13) != -1) {
+        printf("[tv4] pwhash_parallel should have failed (1)\n");
+    }
+    if (crypto_pwhash_argon2i_parallel(out, sizeof out, passwd, strlen(passwd),
+                                       salt, 3, 262144, 0x1000000,
+                                       crypto_pwhash_ALG_ARGON2I13) != -1) {
+        printf("[tv4] pwhash_parallel should have failed (2)\n");
+    }
+    if (crypto_pwhash_argon2i_str_parallel(str_out, passwd, strlen(passwd),
+                                           3, 262144, 4) != 0) {
+        printf("[tv4] pwhash_str_parallel failure\n");
+    }
+    if (strstr(str_out, ",p=4$") == NULL) {
+        printf("[tv4] pwhash_str_parallel doesn't encode the parallelism\n");
+    }
+    if (crypto_pwhash_argon2i_str_verify(str_out, passwd, strlen(passwd)) != 0) {
+        printf("[tv4] pwhash_str_verify(parallel) failure\n");
+    }
+    if (crypto_pwhash_argon2i_str_parallel(str_out, passwd, strlen(passwd),
+                                           3, 262144, 0) != -1) {
+        printf("[tv4] pwhash_str_parallel should have failed\n");
+    }
+}
+
 int main(void)
 {
     char       *str_out;
@@ -222,6 +290,7 @@ int main(void)
     tv();
     tv2();
     tv3();
+    tv4();
     salt = (char *) sodium_malloc(crypto_pwhash_SALTBYTES);
     str_out = (char *) sodium_malloc(crypto_pwhash_STRBYTES);
     str_out2 = (char *) sodium_malloc(crypto_pwhash_STRBYTES);
@@ -125,6 +125,13 @@ static int impl_tests(void)
     impl.close = NULL;
     randombytes_close();
 
+    /* restore the default implementation, for repeated runs */
+#ifndef __native_client__
+    randombytes_set_implementation(&randombytes_sysrandom_implementation);
+#else
+    randombytes_set_implementation(&randombytes_nativeclient_implementation);
+#endif
+
     return 0;
 }
 
@@ -0,0 +1,64 @@
+
+#define TEST_NAME "shorthash_batch"
+#include "cmptest.h"
+
+#define MAXMSGS 67
+#define MAXLEN  100
+
+int
+main(void)
+{
+    unsigned char        k[crypto_shorthash_KEYBYTES];
+    unsigned char        out[MAXMSGS * crypto_shorthash_BYTES];
+    unsigned char        out2[crypto_shorthash_BYTES];
+    unsigned char        buf[MAXMSGS * MAXLEN];
+    const unsigned char *in[MAXMSGS];
+    unsigned long long   inlen[MAXMSGS];
+    char                 hex[2 * crypto_shorthash_BYTES + 1];
+    size_t               i;
+    size_t               fixed;
+    size_t               n;
+    int                  mismatches = 0;
+
+    for (i = 0; i < sizeof k; i++) {
+        k[i] = (unsigned char) i;
+    }
+    for (i = 0; i < sizeof buf; i++) {
+        buf[i] = (unsigned char) (i * 5 + 1);
+    }
+    for (i = 0; i < MAXMSGS; i++) {
+        in[i] = buf + i * MAXLEN;
+    }
+    /* fixed = 0: mixed lengths, otherwise every input is (fixed - 1) bytes */
+    for (fixed = 0; fixed <= 25; fixed++) {
+        for (i = 0; i < MAXMSGS; i++) {
+            inlen[i] = fixed > 0 ? fixed - 1 : (i * 7) % MAXLEN;
+        }
+        for (n = 0; n <= MAXMSGS; n += 1 + n / 4) {
+            memset(out, 0, sizeof out);
+            assert(crypto_shorthash_batch(out, in, inlen, n, k) == 0);
+            for (i = 0; i < n; i++) {
+                crypto_shorthash(out2, in[i], inlen[i], k);
+                if (memcmp(out + i * crypto_shorthash_BYTES, out2,
+                           sizeof out2) != 0) {
+                    printf("mismatch (fixed=%u, n=%u, i=%u)\n",
+                           (unsigned int) fixed, (unsigned int) n,
+                           (unsigned int) i);
+                    mismatches++;
+                }
+            }
+        }
+    }
+    printf("mismatches: %d\n", mismatches);
+
+    for (i = 0; i < 5; i++) {
+        inlen[i] = 8 + 8 * (i & 1);
+    }
+    crypto_shorthash_siphash24_batch(out, in, inlen, 5, k);
+    for (i = 0; i < 5; i++) {
+        printf("%s\n", sodium_bin2hex(hex, sizeof hex,
+                                      out + i * crypto_shorthash_BYTES,
+                                      crypto_shorthash_BYTES));
+    }
+    return 0;
+}
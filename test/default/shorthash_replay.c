@@ -0,0 +1,88 @@
+
+#define TEST_NAME "shorthash_replay"
+#include "cmptest.h"
+
+#define CAPACITY 1000U
+
+static void
+make_nonce(unsigned char nonce[12], unsigned int i)
+{
+    memset(nonce, 0, 12);
+    nonce[0] = (unsigned char) i;
+    nonce[1] = (unsigned char) (i >> 8);
+    nonce[2] = (unsigned char) (i >> 16);
+}
+
+int
+main(void)
+{
+    crypto_shorthash_replay *filter;
+    const unsigned char     *a = (const unsigned char *) "A";
+    const unsigned char     *b = (const unsigned char *) "B";
+    unsigned char            nonce[12];
+    unsigned int             i;
+    unsigned int             fresh;
+    unsigned int             seen;
+
+    assert(crypto_shorthash_replay_new(0U) == NULL);
+    filter = crypto_shorthash_replay_new(CAPACITY);
+    assert(filter != NULL);
+
+    fresh = 0U;
+    for (i = 0U; i < CAPACITY; i++) {
+        make_nonce(nonce, i);
+        if (crypto_shorthash_replay_check_insert(filter, nonce,
+                                                 sizeof nonce) == 0) {
+            fresh++;
+        }
+    }
+    assert(fresh > CAPACITY - CAPACITY / 100U);
+    printf("fresh: %s\n", fresh > CAPACITY - CAPACITY / 100U ? "ok" : "ko");
+
+    /* replays of the current and of the previous filters are rejected */
+    for (i = 0U; i < CAPACITY; i++) {
+        make_nonce(nonce, i);
+        assert(crypto_shorthash_replay_check(filter, nonce, sizeof nonce) == 1);
+        assert(crypto_shorthash_replay_check_insert(filter, nonce,
+                                                    sizeof nonce) == -1);
+    }
+    for (i = CAPACITY; i < 2U * CAPACITY; i++) {
+        make_nonce(nonce, i);
+        fresh += crypto_shorthash_replay_check_insert(filter, nonce,
+                                                      sizeof nonce) == 0;
+    }
+    /* messages are remembered for at least CAPACITY insertions */
+    seen = 0U;
+    for (i = CAPACITY; i < 2U * CAPACITY; i++) {
+        make_nonce(nonce, i);
+        seen += crypto_shorthash_replay_check(filter, nonce, sizeof nonce);
+    }
+    printf("replays: %u\n", seen);
+
+    /* after two more generations, the first messages are forgotten */
+    for (i = 2U * CAPACITY; i < 4U * CAPACITY; i++) {
+        make_nonce(nonce, i);
+        fresh += crypto_shorthash_replay_check_insert(filter, nonce,
+                                                      sizeof nonce) == 0;
+    }
+    seen = 0U;
+    for (i = 0U; i < CAPACITY; i++) {
+        make_nonce(nonce, i);
+        seen += crypto_shorthash_replay_check(filter, nonce, sizeof nonce);
+    }
+    assert(seen < CAPACITY / 100U);
+    printf("forgotten: %s\n", seen < CAPACITY / 100U ? "ok" : "ko");
+    crypto_shorthash_replay_free(filter);
+
+    /* a single message per filter */
+    filter = crypto_shorthash_replay_new(1U);
+    printf("%d\n", crypto_shorthash_replay_check_insert(filter, a, 1U));
+    printf("%d\n", crypto_shorthash_replay_check_insert(filter, a, 1U));
+    printf("%d\n", crypto_shorthash_replay_check_insert(filter, b, 1U));
+    printf("%d\n", crypto_shorthash_replay_check_insert(filter, a, 1U));
+    printf("%d\n", crypto_shorthash_replay_check(filter, b, 1U));
+    crypto_shorthash_replay_free(filter);
+    crypto_shorthash_replay_free(NULL);
+
+    return 0;
+}
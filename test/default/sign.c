@@ -1059,8 +1059,50 @@ static void add_l(unsigned char * const S)
     }
 }
 
+#ifdef BENCHMARKS
+# define VERIFY_ITERATIONS 1000
+
+static void verify_benchmark(void)
+{
+    static int         done;
+    unsigned char      pk[crypto_sign_PUBLICKEYBYTES];
+    unsigned char      sk[crypto_sign_SECRETKEYBYTES];
+    unsigned char      m[64];
+    unsigned char      sm[64 + crypto_sign_BYTES];
+    unsigned long long smlen;
+    unsigned long long ts_start;
+    unsigned long long ts_end;
+    unsigned int       i;
+
+    if (done != 0) {
+        return;
+    }
+    done = 1;
+    crypto_sign_seed_keypair(pk, sk, keypair_seed);
+    memset(m, 0x42, sizeof m);
+    crypto_sign(sm, &smlen, m, sizeof m, sk);
+    ts_start = now();
+    for (i = 0; i < VERIFY_ITERATIONS; i++) {
+        if (crypto_sign_open(m, NULL, sm, smlen, pk) != 0) {
+            abort();
+        }
+    }
+    ts_end = now();
+    fprintf(stdout, "%s: %llu usec/verification\n", TEST_NAME "_open",
+            (ts_end - ts_start) / VERIFY_ITERATIONS);
+}
+#endif
+
 int main(void)
 {
+    crypto_sign_state               st;
+    crypto_sign_ed25519_expandedsk *esk;
+    const unsigned char *msgs[40];
+    unsigned long long   mlens[40];
+    unsigned char        sigs[40 * crypto_sign_BYTES];
+    unsigned char        pks[37 * crypto_sign_PUBLICKEYBYTES];
+    unsigned char        sks[37 * crypto_sign_SECRETKEYBYTES];
+    unsigned char        seeds[37 * crypto_sign_SEEDBYTES];
     unsigned char extracted_seed[crypto_sign_ed25519_SEEDBYTES];
     unsigned char extracted_pk[crypto_sign_ed25519_PUBLICKEYBYTES];
     unsigned char sig[crypto_sign_BYTES];
@@ -1076,7 +1118,14 @@ int main(void)
     unsigned long long mlen;
     unsigned int i;
     unsigned int j;
+    unsigned int k;
 
+#ifdef BENCHMARKS
+    verify_benchmark();
+#endif
+    esk = (crypto_sign_ed25519_expandedsk *)
+        sodium_malloc(crypto_sign_ed25519_expandedskbytes());
+    assert(esk != NULL);
     memset(sig, 0, sizeof sig);
     for (i = 0U; i < (sizeof test_data) / (sizeof test_data[0]); i++) {
 #ifdef BROWSER_TESTS
@@ -1147,7 +1196,19 @@ int main(void)
             printf("detached signature verification failed: [%u]\n", i);
             continue;
         }
+        crypto_sign_ed25519_sk_to_expandedsk(esk, skpk);
+        if (crypto_sign_ed25519_detached_expandedsk
+            (sig, &siglen, (const unsigned char *)test_data[i].m, i, esk) != 0 ||
+            siglen != crypto_sign_BYTES) {
+            printf("detached signature with an expanded key failed: [%u]\n", i);
+            continue;
+        }
+        if (memcmp(test_data[i].sig, sig, crypto_sign_BYTES) != 0) {
+            printf("detached signature with an expanded key failure: [%u]\n", i);
+            continue;
+        }
     }
+    sodium_free(esk);
     printf("%u tests\n", i);
 
     i--;
@@ -1205,6 +1266,92 @@ int main(void)
     if (memcmp(extracted_pk, pk, crypto_sign_ed25519_PUBLICKEYBYTES) != 0) {
         printf("crypto_sign_ed25519_sk_to_pk() failure\n");
     }
+
+    /* Ed25519ph test vector from RFC 8032, section 7.3 */
+    sodium_hex2bin(skpk, sizeof skpk,
+                   "833fe62409237b9d62ec77587520911e"
+                   "9a759cec1d19755b7da901b96dca3d42"
+                   "ec172b93ad5e563bf4932c70e1245034"
+                   "c35467ef2efd4d64ebf819683467e2bf",
+                   2 * sizeof skpk, NULL, NULL, NULL);
+    crypto_sign_init(&st);
+    crypto_sign_update(&st, (const unsigned char *) "ab", 2);
+    crypto_sign_update(&st, (const unsigned char *) "c", 1);
+    crypto_sign_final_create(&st, sig, &siglen, skpk);
+    sodium_bin2hex(sk_hex, sizeof sk_hex, sig, sizeof sig);
+    printf("ph sig: [%s]\n", sk_hex);
+
+    crypto_sign_init(&st);
+    crypto_sign_update(&st, (const unsigned char *) "abc", 3);
+    if (crypto_sign_final_verify(&st, sig, skpk + 32) != 0) {
+        printf("crypto_sign_final_verify() failure\n");
+    }
+    for (k = 0U; k < 3U; k++) {
+        crypto_sign_init(&st);
+        crypto_sign_update(&st, (const unsigned char *) "abc", k);
+        if (crypto_sign_final_verify(&st, sig, skpk + 32) != -1) {
+            printf("crypto_sign_final_verify() accepted a different message\n");
+        }
+    }
+    crypto_sign_ed25519ph_init(&st);
+    crypto_sign_ed25519ph_update(&st, (const unsigned char *) "abc", 3);
+    sig[0] ^= 1;
+    if (crypto_sign_ed25519ph_final_verify(&st, sig, skpk + 32) != -1) {
+        printf("crypto_sign_ed25519ph_final_verify() accepted a forgery\n");
+    }
+    sig[0] ^= 1;
+    if (crypto_sign_verify_detached(sig, (const unsigned char *) "abc", 3,
+                                    skpk + 32) != -1) {
+        printf("Ed25519ph signature verified as a pure Ed25519 signature\n");
+    }
+
+    for (k = 0U; k < 40U; k++) {
+        msgs[k] = (const unsigned char *) test_data[k].m;
+        mlens[k] = k;
+    }
+    if (crypto_sign_ed25519_detached_batch(sigs, msgs, mlens, 0U, sk) != 0) {
+        printf("crypto_sign_ed25519_detached_batch() failure\n");
+    }
+    if (crypto_sign_ed25519_detached_batch(sigs, msgs, mlens, 40U, sk) != 0) {
+        printf("crypto_sign_ed25519_detached_batch() failure\n");
+    }
+    for (k = 0U; k < 40U; k++) {
+        crypto_sign_detached(sig, NULL, msgs[k], mlens[k], sk);
+        if (memcmp(sigs + k * crypto_sign_BYTES, sig, sizeof sig) != 0) {
+            printf("batch signature mismatch: [%u]\n", k);
+        }
+    }
+
+    for (k = 0U; k < 37U * crypto_sign_SEEDBYTES; k++) {
+        seeds[k] = keypair_seed[k % crypto_sign_SEEDBYTES] ^ (k / 32U);
+    }
+    if (crypto_sign_seed_keypair_batch(pks, sks, seeds, 37U) != 0) {
+        printf("crypto_sign_seed_keypair_batch() failure\n");
+    }
+    for (k = 0U; k < 37U; k++) {
+        crypto_sign_seed_keypair(extracted_pk, skpk,
+                                 seeds + k * crypto_sign_SEEDBYTES);
+        if (memcmp(extracted_pk, pks + k * crypto_sign_PUBLICKEYBYTES,
+                   sizeof extracted_pk) != 0 ||
+            memcmp(skpk, sks + k * crypto_sign_SECRETKEYBYTES,
+                   sizeof skpk) != 0) {
+            printf("crypto_sign_seed_keypair_batch() mismatch: [%u]\n", k);
+        }
+    }
+    if (crypto_sign_keypair_batch(pks, sks, 37U) != 0) {
+        printf("crypto_sign_keypair_batch() failure\n");
+    }
+    for (k = 0U; k < 37U; k++) {
+        crypto_sign_seed_keypair(extracted_pk, skpk,
+                                 sks + k * crypto_sign_SECRETKEYBYTES);
+        if (memcmp(extracted_pk, pks + k * crypto_sign_PUBLICKEYBYTES,
+                   sizeof extracted_pk) != 0 ||
+            memcmp(skpk, sks + k * crypto_sign_SECRETKEYBYTES,
+                   sizeof skpk) != 0) {
+            printf("crypto_sign_keypair_batch() mismatch: [%u]\n", k);
+        }
+    }
+
     sodium_bin2hex(pk_hex, sizeof pk_hex, pk, sizeof pk);
     sodium_bin2hex(sk_hex, sizeof sk_hex, sk, sizeof sk);
 
@@ -1222,6 +1369,10 @@ int main(void)
            == crypto_sign_ed25519_publickeybytes());
     assert(crypto_sign_secretkeybytes()
            == crypto_sign_ed25519_secretkeybytes());
+    assert(crypto_sign_statebytes() == sizeof(crypto_sign_state));
+    assert(crypto_sign_statebytes() == crypto_sign_ed25519ph_statebytes());
+    assert(crypto_sign_ed25519_expandedskbytes()
+           == sizeof(crypto_sign_ed25519_expandedsk));
 
     return 0;
 }
@@ -11,8 +11,10 @@ int main(void)
     (void)sodium_runtime_has_sse3();
     (void)sodium_runtime_has_ssse3();
     (void)sodium_runtime_has_sse41();
+    (void)sodium_runtime_has_bmi2();
     (void)sodium_runtime_has_pclmul();
     (void)sodium_runtime_has_aesni();
+    (void)sodium_runtime_has_shani();
 
     return 0;
 }